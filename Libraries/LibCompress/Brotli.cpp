@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibCompress/Brotli.h>
+
+#include <brotli/decode.h>
+
+namespace Compress {
+
+ErrorOr<NonnullOwnPtr<BrotliDecompressor>> BrotliDecompressor::create(MaybeOwned<Stream> stream, ReadonlyBytes dictionary)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(16 * 1024));
+    auto dictionary_copy = TRY(ByteBuffer::copy(dictionary));
+
+    auto* state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+    if (!state)
+        return Error::from_errno(ENOMEM);
+
+    if (!dictionary_copy.is_empty() && !BrotliDecoderAttachDictionary(state, BROTLI_SHARED_DICTIONARY_RAW, dictionary_copy.size(), dictionary_copy.data())) {
+        BrotliDecoderDestroyInstance(state);
+        return Error::from_string_literal("Unable to attach brotli dictionary");
+    }
+
+    auto decompressor = adopt_own_if_nonnull(new (nothrow) BrotliDecompressor(move(buffer), move(dictionary_copy), move(stream), state));
+    if (!decompressor) {
+        BrotliDecoderDestroyInstance(state);
+        return Error::from_errno(ENOMEM);
+    }
+    return decompressor.release_nonnull();
+}
+
+ErrorOr<ByteBuffer> BrotliDecompressor::decompress_all(ReadonlyBytes bytes, ReadonlyBytes dictionary)
+{
+    auto decompressor = TRY(create(make<FixedMemoryStream>(bytes), dictionary));
+    return decompressor->read_until_eof(4096);
+}
+
+BrotliDecompressor::BrotliDecompressor(AK::FixedArray<u8> buffer, ByteBuffer dictionary, MaybeOwned<Stream> stream, BrotliDecoderState* state)
+    : m_stream(move(stream))
+    , m_state(state)
+    , m_dictionary(move(dictionary))
+    , m_buffer(move(buffer))
+{
+}
+
+BrotliDecompressor::~BrotliDecompressor()
+{
+    BrotliDecoderDestroyInstance(m_state);
+}
+
+ErrorOr<Bytes> BrotliDecompressor::read_some(Bytes bytes)
+{
+    auto previous_output_buffer_was_full = exchange(m_output_buffer_was_full, false);
+
+    size_t available_out = bytes.size();
+    auto* next_out = bytes.data();
+
+    bool has_read_input = false;
+
+    while (!m_eof && available_out > 0) {
+        if (m_input.is_empty() && !BrotliDecoderHasMoreOutput(m_state)) {
+            // Hand out what we have so far before waiting for more input. Like the zlib decompressors, we only read
+            // from the underlying stream once per call, as it may not have any more data for us yet.
+            if (has_read_input || available_out < bytes.size())
+                break;
+
+            m_input = TRY(m_stream->read_some(m_buffer.span()));
+            has_read_input = true;
+
+            if (m_input.is_empty()) {
+                // NOTE: If we filled the caller's buffer last time, we had no way of knowing whether there was more
+                //       output to come, so this isn't necessarily the end of the data.
+                if (!m_stream->is_eof() || previous_output_buffer_was_full)
+                    break;
+                return Error::from_string_literal("Unexpected end of brotli data");
+            }
+        }
+
+        size_t available_in = m_input.size();
+        auto const* next_in = m_input.data();
+
+        auto result = BrotliDecoderDecompressStream(m_state, &available_in, &next_in, &available_out, &next_out, nullptr);
+        m_input = m_input.slice_from_end(available_in);
+
+        if (result == BROTLI_DECODER_RESULT_ERROR)
+            return Error::from_string_literal("Invalid brotli data");
+        if (result == BROTLI_DECODER_RESULT_SUCCESS)
+            m_eof = true;
+    }
+
+    m_output_buffer_was_full = available_out == 0;
+    return bytes.slice(0, bytes.size() - available_out);
+}
+
+ErrorOr<size_t> BrotliDecompressor::write_some(ReadonlyBytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+bool BrotliDecompressor::is_eof() const
+{
+    return m_eof;
+}
+
+bool BrotliDecompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void BrotliDecompressor::close()
+{
+}
+
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/FixedArray.h>
+#include <AK/MaybeOwned.h>
+#include <AK/Stream.h>
+
+extern "C" {
+typedef struct BrotliDecoderStateStruct BrotliDecoderState;
+}
+
+namespace Compress {
+
+class BrotliDecompressor final : public Stream {
+    AK_MAKE_NONCOPYABLE(BrotliDecompressor);
+
+public:
+    // The dictionary, if any, is a raw shared dictionary, as used by Compression Dictionary Transport (RFC 9842).
+    static ErrorOr<NonnullOwnPtr<BrotliDecompressor>> create(MaybeOwned<Stream>, ReadonlyBytes dictionary = {});
+    static ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes, ReadonlyBytes dictionary = {});
+
+    ~BrotliDecompressor() override;
+
+    virtual ErrorOr<Bytes> read_some(Bytes) override;
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override;
+    virtual void close() override;
+
+private:
+    BrotliDecompressor(AK::FixedArray<u8>, ByteBuffer dictionary, MaybeOwned<Stream>, BrotliDecoderState*);
+
+    MaybeOwned<Stream> m_stream;
+    BrotliDecoderState* m_state { nullptr };
+
+    // NOTE: The decoder refers to the dictionary rather than copying it, so we have to keep it alive.
+    ByteBuffer m_dictionary;
+
+    AK::FixedArray<u8> m_buffer;
+    ReadonlyBytes m_input;
+
+    bool m_output_buffer_was_full { false };
+    bool m_eof { false };
+};
+
+}
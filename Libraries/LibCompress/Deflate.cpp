@@ -9,6 +9,7 @@
 #include <AK/BinarySearch.h>
 #include <LibCompress/Deflate.h>
 #include <LibCompress/DeflateTables.h>
+#include <LibCompress/ParallelInflate.h>
 
 #include <zlib.h>
 
@@ -168,6 +169,10 @@ ErrorOr<NonnullOwnPtr<DeflateDecompressor>> DeflateDecompressor::create(MaybeOwn
 
 ErrorOr<ByteBuffer> DeflateDecompressor::decompress_all(ReadonlyBytes bytes)
 {
+    // OPTIMIZATION: Large streams with full flush points can be decoded on multiple threads.
+    if (auto output = try_inflate_in_parallel(bytes, ParallelInflateFormat::Raw); output.has_value())
+        return output.release_value();
+
     return ::Compress::decompress_all<DeflateDecompressor>(bytes);
 }
 
@@ -7,6 +7,7 @@
  */
 
 #include <LibCompress/Gzip.h>
+#include <LibCompress/ParallelInflate.h>
 
 #include <zlib.h>
 
@@ -21,6 +22,10 @@ ErrorOr<NonnullOwnPtr<GzipDecompressor>> GzipDecompressor::create(MaybeOwned<Str
 
 ErrorOr<ByteBuffer> GzipDecompressor::decompress_all(ReadonlyBytes bytes)
 {
+    // OPTIMIZATION: Large files written by parallel compressors like pigz can be decoded on multiple threads.
+    if (auto output = try_inflate_in_parallel(bytes, ParallelInflateFormat::Gzip); output.has_value())
+        return output.release_value();
+
     return ::Compress::decompress_all<GzipDecompressor>(bytes);
 }
 
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteReader.h>
+#include <AK/Endian.h>
+#include <AK/NumericLimits.h>
+#include <AK/ScopeGuard.h>
+#include <AK/Vector.h>
+#include <LibCompress/ParallelInflate.h>
+#include <LibCore/System.h>
+#include <LibThreading/Thread.h>
+
+#include <string.h>
+#include <zlib.h>
+
+namespace Compress {
+
+// Splitting smaller inputs isn't worth the cost of starting threads.
+static constexpr size_t minimum_input_size = 1 * MiB;
+static constexpr size_t minimum_range_size = 512 * KiB;
+
+// The maximum distance that back-references may reach.
+static constexpr size_t window_size = 32 * KiB;
+
+static constexpr size_t output_chunk_size = 64 * KiB;
+
+enum class BoundaryKind : u8 {
+    // A new deflate stream starts here, i.e. a gzip member in gzip mode.
+    StreamStart,
+
+    // The empty stored block that a compressor emits when flushing ends right before this position.
+    FlushPoint,
+};
+
+struct Boundary {
+    size_t offset { 0 };
+    BoundaryKind kind { BoundaryKind::StreamStart };
+};
+
+// The part of a gzip member that was decoded by a single range.
+struct DecodedMemberPart {
+    bool starts_member { false };
+    bool ends_member { false };
+
+    u32 crc { 0 };
+    size_t size { 0 };
+
+    // The values from the member's trailer, if the part ends the member.
+    u32 expected_crc { 0 };
+    u32 expected_size { 0 };
+};
+
+struct DecodedRange {
+    ByteBuffer output;
+    Vector<DecodedMemberPart> parts;
+
+    // The boundary at which decoding stopped, or the number of boundaries if it reached the end of the input.
+    size_t end_boundary_index { 0 };
+};
+
+// https://www.rfc-editor.org/rfc/rfc1952#section-2.3
+static ErrorOr<size_t> parse_gzip_header(ReadonlyBytes bytes)
+{
+    static constexpr u8 FHCRC = 1 << 1;
+    static constexpr u8 FEXTRA = 1 << 2;
+    static constexpr u8 FNAME = 1 << 3;
+    static constexpr u8 FCOMMENT = 1 << 4;
+    static constexpr u8 reserved_flags = 0xe0;
+
+    if (bytes.size() < 10 || bytes[0] != 0x1f || bytes[1] != 0x8b || bytes[2] != Z_DEFLATED)
+        return Error::from_string_literal("Invalid gzip header");
+
+    auto flags = bytes[3];
+    if (flags & reserved_flags)
+        return Error::from_string_literal("Invalid gzip header");
+
+    size_t offset = 10;
+
+    if (flags & FEXTRA) {
+        if (offset + 2 > bytes.size())
+            return Error::from_string_literal("Invalid gzip header");
+        offset += 2 + (bytes[offset] | bytes[offset + 1] << 8);
+    }
+
+    auto skip_zero_terminated_string = [&]() -> ErrorOr<void> {
+        while (offset < bytes.size() && bytes[offset] != 0)
+            ++offset;
+        if (offset >= bytes.size())
+            return Error::from_string_literal("Invalid gzip header");
+        ++offset;
+        return {};
+    };
+
+    if (flags & FNAME)
+        TRY(skip_zero_terminated_string());
+    if (flags & FCOMMENT)
+        TRY(skip_zero_terminated_string());
+
+    if (flags & FHCRC) {
+        if (offset + 2 > bytes.size())
+            return Error::from_string_literal("Invalid gzip header");
+        auto expected_crc = bytes[offset] | bytes[offset + 1] << 8;
+        if ((crc32_z(0, bytes.data(), offset) & 0xffff) != static_cast<uLong>(expected_crc))
+            return Error::from_string_literal("Invalid gzip header");
+        offset += 2;
+    }
+
+    if (offset > bytes.size())
+        return Error::from_string_literal("Invalid gzip header");
+    return offset;
+}
+
+// Finds the first position in [start, end) at which decoding may start without knowing what came before it. This is
+// only a guess, as the byte patterns we look for may just as well occur in the compressed data.
+static Optional<Boundary> find_boundary(ReadonlyBytes input, ParallelInflateFormat format, size_t start, size_t end)
+{
+    Optional<Boundary> boundary;
+
+    // A flush ends with an empty stored block, which is byte-aligned and consists of the bytes 00 00 ff ff.
+    for (auto offset = start; offset < end;) {
+        auto const* found = static_cast<u8 const*>(memchr(input.offset_pointer(offset), 0xff, end - offset));
+        if (!found)
+            break;
+
+        offset = found - input.data();
+        if (offset >= 2 && offset + 2 < input.size() && input[offset - 2] == 0 && input[offset - 1] == 0 && input[offset + 1] == 0xff) {
+            boundary = Boundary { offset + 2, BoundaryKind::FlushPoint };
+            break;
+        }
+        ++offset;
+    }
+
+    if (format != ParallelInflateFormat::Gzip)
+        return boundary;
+
+    if (boundary.has_value())
+        end = min(end, boundary->offset);
+
+    for (auto offset = start; offset < end;) {
+        auto const* found = static_cast<u8 const*>(memchr(input.offset_pointer(offset), 0x1f, end - offset));
+        if (!found)
+            break;
+
+        offset = found - input.data();
+        if (!parse_gzip_header(input.slice(offset)).is_error())
+            return Boundary { offset, BoundaryKind::StreamStart };
+        ++offset;
+    }
+
+    return boundary;
+}
+
+static Vector<Boundary> find_boundaries(ReadonlyBytes input, ParallelInflateFormat format, size_t range_count)
+{
+    Vector<Boundary> boundaries;
+    boundaries.append({ 0, BoundaryKind::StreamStart });
+
+    for (size_t i = 1; i < range_count; ++i) {
+        auto start = max(input.size() / range_count * i, boundaries.last().offset + 1);
+        auto end = input.size() / range_count * (i + 1);
+        if (start >= end)
+            continue;
+
+        if (auto boundary = find_boundary(input, format, start, end); boundary.has_value())
+            boundaries.append(*boundary);
+    }
+
+    return boundaries;
+}
+
+// Decodes the input from the given boundary up to the next boundary that the decoder confirms as the start of an
+// independent part, or up to the end of the input.
+static ErrorOr<DecodedRange> decode_range(ReadonlyBytes input, ParallelInflateFormat format, Vector<Boundary> const& boundaries, size_t boundary_index, ReadonlyBytes dictionary)
+{
+    z_stream stream {};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+        return Error::from_errno(ENOMEM);
+    ScopeGuard end_stream = [&] { inflateEnd(&stream); };
+
+    auto is_gzip = format == ParallelInflateFormat::Gzip;
+
+    DecodedRange range;
+    DecodedMemberPart part;
+    size_t part_start = 0;
+
+    auto position = boundaries[boundary_index].offset;
+    auto next_boundary_index = boundary_index + 1;
+
+    auto skip_boundaries_before_position = [&] {
+        while (next_boundary_index < boundaries.size() && boundaries[next_boundary_index].offset <= position)
+            ++next_boundary_index;
+    };
+
+    auto limit = [&] {
+        return next_boundary_index < boundaries.size() ? boundaries[next_boundary_index].offset : input.size();
+    };
+
+    auto written = [&] { return range.output.size() - stream.avail_out; };
+
+    auto finish_part = [&]() -> ErrorOr<void> {
+        if (!is_gzip)
+            return {};
+
+        auto part_output = range.output.bytes().slice(part_start, written() - part_start);
+        part.crc = crc32_z(0, part_output.data(), part_output.size());
+        part.size = part_output.size();
+        TRY(range.parts.try_append(part));
+
+        part = {};
+        part_start = written();
+        return {};
+    };
+
+    if (boundaries[boundary_index].kind == BoundaryKind::StreamStart) {
+        if (is_gzip)
+            position += TRY(parse_gzip_header(input.slice(position)));
+        part.starts_member = true;
+    } else if (!dictionary.is_empty()) {
+        if (inflateSetDictionary(&stream, dictionary.data(), dictionary.size()) != Z_OK)
+            return Error::from_string_literal("Unable to set deflate dictionary");
+    }
+    skip_boundaries_before_position();
+
+    while (true) {
+        if (stream.avail_out == 0) {
+            auto bytes = TRY(range.output.get_bytes_for_writing(max(range.output.size() / 2, output_chunk_size)));
+            stream.next_out = bytes.data();
+            stream.avail_out = bytes.size();
+        }
+
+        stream.next_in = const_cast<u8*>(input.offset_pointer(position));
+        stream.avail_in = min(limit() - position, static_cast<size_t>(NumericLimits<uInt>::max()));
+
+        // NOTE: Z_BLOCK makes inflate stop at the end of each block, so we can tell whether the decoder is at a block
+        //       boundary once it has consumed all the input up to the next boundary.
+        auto result = inflate(&stream, Z_BLOCK);
+        position = stream.next_in - input.data();
+
+        if (result == Z_STREAM_END) {
+            if (is_gzip) {
+                if (position + 8 > input.size())
+                    return Error::from_string_literal("Unexpected end of gzip data");
+
+                part.ends_member = true;
+                part.expected_crc = AK::convert_between_host_and_little_endian(ByteReader::load32(input.offset_pointer(position)));
+                part.expected_size = AK::convert_between_host_and_little_endian(ByteReader::load32(input.offset_pointer(position + 4)));
+                position += 8;
+            }
+            TRY(finish_part());
+
+            if (position == input.size()) {
+                range.end_boundary_index = boundaries.size();
+                break;
+            }
+
+            // Another member follows. If its start is the next boundary, another range has decoded it already.
+            if (is_gzip) {
+                while (next_boundary_index < boundaries.size() && boundaries[next_boundary_index].offset < position)
+                    ++next_boundary_index;
+                if (next_boundary_index < boundaries.size() && boundaries[next_boundary_index].offset == position && boundaries[next_boundary_index].kind == BoundaryKind::StreamStart) {
+                    range.end_boundary_index = next_boundary_index;
+                    break;
+                }
+
+                position += TRY(parse_gzip_header(input.slice(position)));
+            }
+
+            // NOTE: Like the sequential decoder, we continue with a fresh stream in raw mode as well.
+            inflateReset(&stream);
+            part.starts_member = true;
+            skip_boundaries_before_position();
+            continue;
+        }
+
+        if (result != Z_OK && result != Z_BUF_ERROR)
+            return Error::from_string_literal("Invalid deflate data");
+
+        if (position < limit()) {
+            if (result == Z_BUF_ERROR && stream.avail_out > 0)
+                return Error::from_string_literal("Invalid deflate data");
+            continue;
+        }
+
+        // There may be more output for the input that we have already consumed.
+        if (stream.avail_out == 0)
+            continue;
+
+        // The next part may only be decoded independently if it starts on a byte-aligned block boundary. The decoder
+        // tells us whether it stopped at the end of a block (128), how many bits it holds on to (0 - 63), and whether
+        // the block it decodes is the last one (64).
+        auto is_at_block_boundary = (stream.data_type & 0xff) == 128;
+        if (is_at_block_boundary && next_boundary_index < boundaries.size() && boundaries[next_boundary_index].kind == BoundaryKind::FlushPoint) {
+            TRY(finish_part());
+            range.end_boundary_index = next_boundary_index;
+            break;
+        }
+
+        // NOTE: The decoder may have buffered the bits of the next block already, so keep going until it can't make
+        //       any progress without more input.
+        if (result == Z_OK)
+            continue;
+
+        if (next_boundary_index == boundaries.size())
+            return Error::from_string_literal("Unexpected end of deflate data");
+
+        ++next_boundary_index;
+    }
+
+    range.output.resize(written());
+    return range;
+}
+
+Optional<ByteBuffer> try_inflate_in_parallel(ReadonlyBytes input, ParallelInflateFormat format, ParallelInflateOptions const& options)
+{
+    if (input.size() < minimum_input_size)
+        return {};
+
+    auto maximum_range_count = options.maximum_range_count.value_or_lazy_evaluated([] { return Core::System::hardware_concurrency(); });
+    auto range_count = min<size_t>(maximum_range_count, input.size() / minimum_range_size);
+    if (range_count < 2)
+        return {};
+
+    auto boundaries = find_boundaries(input, format, range_count);
+    if (boundaries.size() < 2)
+        return {};
+
+    Vector<Optional<DecodedRange>> ranges;
+    if (ranges.try_resize(boundaries.size()).is_error())
+        return {};
+
+    auto decode_range_at = [&](size_t index) {
+        if (auto range = decode_range(input, format, boundaries, index, {}); !range.is_error())
+            ranges[index] = range.release_value();
+    };
+
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    Vector<size_t> ranges_to_decode_here;
+    ranges_to_decode_here.append(0);
+
+    for (size_t index = 1; index < boundaries.size(); ++index) {
+        auto thread = Threading::Thread::try_create([&decode_range_at, index]() -> intptr_t {
+            decode_range_at(index);
+            return 0;
+        },
+            "Inflate"sv);
+
+        if (thread.is_error() || threads.try_append(thread.value()).is_error()) {
+            ranges_to_decode_here.append(index);
+            continue;
+        }
+        threads.last()->start();
+    }
+
+    for (auto index : ranges_to_decode_here)
+        decode_range_at(index);
+
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    // Stitch the ranges together, following the boundaries at which each of them stopped.
+    ByteBuffer output;
+
+    u32 member_crc = 0;
+    size_t member_size = 0;
+    bool is_in_member = false;
+
+    for (size_t index = 0; index < boundaries.size();) {
+        if (!ranges[index].has_value()) {
+            // NOTE: A sync flush emits the same empty stored block as a full flush, but doesn't reset the window, so the
+            //       data after it may refer back to the data before it. We know that data now.
+            if (index == 0 || boundaries[index].kind != BoundaryKind::FlushPoint)
+                return {};
+
+            // NOTE: If not even the first range after the initial one could be decoded on its own, the input was most
+            //       likely sync flushed throughout. Decoding the rest of it here would be just as slow as the sequential
+            //       decoder, and would then only be followed by a copy of the output, so leave it to that decoder.
+            if (index == ranges[0]->end_boundary_index)
+                return {};
+
+            auto dictionary = output.bytes().slice_from_end(min(output.size(), window_size));
+            auto range = decode_range(input, format, boundaries, index, dictionary);
+            if (range.is_error())
+                return {};
+            ranges[index] = range.release_value();
+        }
+
+        auto& range = *ranges[index];
+
+        for (auto const& part : range.parts) {
+            if (part.starts_member == is_in_member)
+                return {};
+
+            if (part.starts_member) {
+                member_crc = part.crc;
+                member_size = part.size;
+                is_in_member = true;
+            } else {
+                member_crc = crc32_combine(member_crc, part.crc, static_cast<z_off_t>(part.size));
+                member_size += part.size;
+            }
+
+            if (part.ends_member) {
+                if (member_crc != part.expected_crc || static_cast<u32>(member_size) != part.expected_size)
+                    return {};
+                is_in_member = false;
+            }
+        }
+
+        if (output.is_empty() && range.end_boundary_index == boundaries.size())
+            return move(range.output);
+
+        if (output.try_append(range.output).is_error())
+            return {};
+
+        index = range.end_boundary_index;
+    }
+
+    if (is_in_member)
+        return {};
+
+    return output;
+}
+
+}
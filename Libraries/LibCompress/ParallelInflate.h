@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Optional.h>
+
+namespace Compress {
+
+enum class ParallelInflateFormat : u8 {
+    Raw,
+    Gzip,
+};
+
+struct ParallelInflateOptions {
+    // The number of ranges to split the input into, at most. Defaults to the number of hardware threads, and is only
+    // overridden by tests, so that they take the parallel path on machines with a single core as well.
+    Optional<size_t> maximum_range_count;
+};
+
+// Large inputs can often be split into parts that may be decoded independently of each other: gzip files may consist
+// of several members (e.g. when they were written by pigz or concatenated), and a full flush resets the compressor's
+// window, so that no data after it refers back to data before it. This decodes such parts on multiple threads.
+//
+// Returns an empty Optional if the input can't be split, or if anything goes wrong, in which case the input has to be
+// decoded sequentially instead. That way, errors are always reported by the sequential decoder.
+Optional<ByteBuffer> try_inflate_in_parallel(ReadonlyBytes, ParallelInflateFormat, ParallelInflateOptions const& = {});
+
+}
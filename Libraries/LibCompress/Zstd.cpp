@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibCompress/Zstd.h>
+
+#include <zstd.h>
+
+namespace Compress {
+
+ErrorOr<NonnullOwnPtr<ZstdDecompressor>> ZstdDecompressor::create(MaybeOwned<Stream> stream, ReadonlyBytes dictionary)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(ZSTD_DStreamInSize()));
+
+    auto* context = ZSTD_createDCtx();
+    if (!context)
+        return Error::from_errno(ENOMEM);
+
+    // NOTE: The dictionary is copied into the context.
+    if (!dictionary.is_empty()) {
+        if (auto result = ZSTD_DCtx_loadDictionary(context, dictionary.data(), dictionary.size()); ZSTD_isError(result)) {
+            ZSTD_freeDCtx(context);
+            return Error::from_string_literal("Unable to load zstd dictionary");
+        }
+    }
+
+    auto decompressor = adopt_own_if_nonnull(new (nothrow) ZstdDecompressor(move(buffer), move(stream), context));
+    if (!decompressor) {
+        ZSTD_freeDCtx(context);
+        return Error::from_errno(ENOMEM);
+    }
+    return decompressor.release_nonnull();
+}
+
+ErrorOr<ByteBuffer> ZstdDecompressor::decompress_all(ReadonlyBytes bytes, ReadonlyBytes dictionary)
+{
+    auto decompressor = TRY(create(make<FixedMemoryStream>(bytes), dictionary));
+    decompressor->did_receive_all_input();
+    return decompressor->read_until_eof(4096);
+}
+
+ZstdDecompressor::ZstdDecompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, ZSTD_DCtx* context)
+    : m_stream(move(stream))
+    , m_context(context)
+    , m_buffer(move(buffer))
+{
+}
+
+ZstdDecompressor::~ZstdDecompressor()
+{
+    ZSTD_freeDCtx(m_context);
+}
+
+ErrorOr<Bytes> ZstdDecompressor::read_some(Bytes bytes)
+{
+    ZSTD_outBuffer output { bytes.data(), bytes.size(), 0 };
+
+    bool has_read_input = false;
+
+    while (!m_eof && output.pos < output.size) {
+        if (m_input.is_empty() && !m_may_have_more_output) {
+            // Hand out what we have so far before waiting for more input. Like the zlib decompressors, we only read
+            // from the underlying stream once per call, as it may not have any more data for us yet.
+            if (has_read_input || output.pos > 0)
+                break;
+
+            m_input = TRY(m_stream->read_some(m_buffer.span()));
+            has_read_input = true;
+
+            if (m_input.is_empty()) {
+                // NOTE: Until the caller tells us otherwise, more data may still be written to the underlying stream.
+                if (!m_has_received_all_input || !m_stream->is_eof())
+                    break;
+                if (m_is_in_frame)
+                    return Error::from_string_literal("Unexpected end of zstd data");
+
+                m_eof = true;
+                break;
+            }
+        }
+
+        ZSTD_inBuffer input { m_input.data(), m_input.size(), 0 };
+
+        auto result = ZSTD_decompressStream(m_context, &output, &input);
+        if (ZSTD_isError(result))
+            return Error::from_string_literal("Invalid zstd data");
+
+        m_input = m_input.slice(input.pos);
+
+        // If the decoder didn't fill the output buffer, it has flushed everything it could.
+        m_may_have_more_output = output.pos == output.size;
+
+        // A result of 0 means that a frame has been decoded and flushed completely. Another frame may follow it.
+        m_is_in_frame = result != 0;
+        if (!m_is_in_frame && m_input.is_empty() && m_has_received_all_input && m_stream->is_eof())
+            m_eof = true;
+    }
+
+    return bytes.slice(0, output.pos);
+}
+
+ErrorOr<size_t> ZstdDecompressor::write_some(ReadonlyBytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+bool ZstdDecompressor::is_eof() const
+{
+    return m_eof;
+}
+
+bool ZstdDecompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void ZstdDecompressor::close()
+{
+}
+
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/FixedArray.h>
+#include <AK/MaybeOwned.h>
+#include <AK/Stream.h>
+
+extern "C" {
+typedef struct ZSTD_DCtx_s ZSTD_DCtx;
+}
+
+namespace Compress {
+
+class ZstdDecompressor final : public Stream {
+    AK_MAKE_NONCOPYABLE(ZstdDecompressor);
+
+public:
+    // The dictionary, if any, may either be a zstd dictionary or raw content, as used by Compression Dictionary
+    // Transport (RFC 9842).
+    static ErrorOr<NonnullOwnPtr<ZstdDecompressor>> create(MaybeOwned<Stream>, ReadonlyBytes dictionary = {});
+    static ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes, ReadonlyBytes dictionary = {});
+
+    ~ZstdDecompressor() override;
+
+    virtual ErrorOr<Bytes> read_some(Bytes) override;
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override;
+    virtual bool is_eof() const override;
+    virtual bool is_open() const override;
+    virtual void close() override;
+
+    // A zstd stream may consist of any number of frames, so running out of input between two frames doesn't tell us
+    // whether the data has ended. Once the caller knows that no more data will be written to the underlying stream, it
+    // has to tell us, after which the end of the stream is reported once all of its data has been decompressed.
+    void did_receive_all_input() { m_has_received_all_input = true; }
+
+private:
+    ZstdDecompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, ZSTD_DCtx*);
+
+    MaybeOwned<Stream> m_stream;
+    ZSTD_DCtx* m_context { nullptr };
+
+    AK::FixedArray<u8> m_buffer;
+    ReadonlyBytes m_input;
+
+    // Whether the decoder may still hold output that it couldn't fit into the caller's buffer.
+    bool m_may_have_more_output { false };
+    bool m_is_in_frame { false };
+
+    bool m_has_received_all_input { false };
+    bool m_eof { false };
+};
+
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <LibCore/SharedRingBuffer.h>
+
+namespace Core {
+
+ErrorOr<SharedRingBuffer> SharedRingBuffer::create(size_t capacity)
+{
+    VERIFY(capacity != 0 && popcount(capacity) == 1);
+
+    auto buffer = TRY(AnonymousBuffer::create_with_size(data_offset + capacity));
+    new (buffer.data<void>()) Header;
+    return SharedRingBuffer { move(buffer), capacity };
+}
+
+ErrorOr<SharedRingBuffer> SharedRingBuffer::attach(AnonymousBuffer buffer)
+{
+    if (!buffer.is_valid() || buffer.size() <= data_offset)
+        return Error::from_string_literal("Shared ring buffer is too small");
+
+    auto capacity = buffer.size() - data_offset;
+    if (popcount(capacity) != 1)
+        return Error::from_string_literal("Shared ring buffer capacity is not a power of two");
+
+    return SharedRingBuffer { move(buffer), capacity };
+}
+
+size_t SharedRingBuffer::used_size(u64 write_offset, u64 read_offset) const
+{
+    // NOTE: A misbehaving peer could have moved its offset anywhere, so make sure we never go past the end of the ring.
+    if (write_offset < read_offset)
+        return 0;
+    return min(write_offset - read_offset, m_capacity);
+}
+
+Bytes SharedRingBuffer::writable_bytes()
+{
+    auto write_offset = header().write_offset.load(AK::MemoryOrder::memory_order_relaxed);
+    auto read_offset = header().read_offset.load(AK::MemoryOrder::memory_order_acquire);
+    if (write_offset < read_offset)
+        return {};
+
+    auto free_size = m_capacity - used_size(write_offset, read_offset);
+    auto index = write_offset & (m_capacity - 1);
+    return { data() + index, min(free_size, m_capacity - index) };
+}
+
+void SharedRingBuffer::did_write(size_t size)
+{
+    header().write_offset.fetch_add(size);
+}
+
+size_t SharedRingBuffer::write_some(ReadonlyBytes bytes)
+{
+    size_t total_written = 0;
+
+    // The free space may wrap around the end of the ring, in which case it takes two copies to fill it.
+    for (size_t i = 0; i < 2 && !bytes.is_empty(); ++i) {
+        auto destination = writable_bytes();
+        if (destination.is_empty())
+            break;
+
+        auto written = bytes.copy_trimmed_to(destination);
+        did_write(written);
+        bytes = bytes.slice(written);
+        total_written += written;
+    }
+
+    return total_written;
+}
+
+void SharedRingBuffer::close_for_writing()
+{
+    header().closed_for_writing.store(true);
+}
+
+ReadonlyBytes SharedRingBuffer::readable_bytes() const
+{
+    auto write_offset = header().write_offset.load(AK::MemoryOrder::memory_order_acquire);
+    auto read_offset = header().read_offset.load(AK::MemoryOrder::memory_order_relaxed);
+
+    auto used = used_size(write_offset, read_offset);
+    auto index = read_offset & (m_capacity - 1);
+    return { data() + index, min(used, m_capacity - index) };
+}
+
+void SharedRingBuffer::did_read(size_t size)
+{
+    header().read_offset.fetch_add(size);
+}
+
+bool SharedRingBuffer::is_closed_for_writing() const
+{
+    return header().closed_for_writing.load();
+}
+
+}
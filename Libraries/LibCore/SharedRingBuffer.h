@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Error.h>
+#include <AK/Span.h>
+#include <AK/Types.h>
+#include <LibCore/AnonymousBuffer.h>
+
+namespace Core {
+
+// A single-producer, single-consumer ring of bytes residing in shared memory, meant to stream data from one process
+// to another without going through the kernel for every chunk. Both sides map the same AnonymousBuffer, which is
+// transferred over IPC.
+//
+// The ring does not provide a way to block. Instead, each side can flag that it is waiting for the other one, and the
+// other side tells it so (e.g. by writing to a pipe) once it has made progress:
+//
+//     Consumer                                    Producer
+//     drain readable_bytes()                      write into writable_bytes()
+//     set_reader_waiting(true)                    if (take_reader_waiting())
+//     if (readable_bytes() is not empty)              wake the consumer
+//         set_reader_waiting(false), drain again
+//
+// As the other process can't be trusted to leave the shared state intact, all offsets read from shared memory are
+// clamped before being used.
+class SharedRingBuffer {
+public:
+    // The capacity must be a power of two.
+    static ErrorOr<SharedRingBuffer> create(size_t capacity);
+    static ErrorOr<SharedRingBuffer> attach(AnonymousBuffer);
+
+    SharedRingBuffer() = default;
+
+    bool is_valid() const { return m_buffer.is_valid(); }
+    AnonymousBuffer const& anonymous_buffer() const { return m_buffer; }
+    size_t capacity() const { return m_capacity; }
+
+    // Producer side.
+    Bytes writable_bytes();
+    void did_write(size_t);
+    size_t write_some(ReadonlyBytes);
+    void close_for_writing();
+
+    // Consumer side.
+    ReadonlyBytes readable_bytes() const;
+    void did_read(size_t);
+    bool is_closed_for_writing() const;
+    bool is_eof() const { return is_closed_for_writing() && readable_bytes().is_empty(); }
+
+    void set_reader_waiting(bool waiting) { header().reader_waiting.store(waiting); }
+    bool take_reader_waiting() { return header().reader_waiting.exchange(false); }
+
+    void set_writer_waiting(bool waiting) { header().writer_waiting.store(waiting); }
+    bool take_writer_waiting() { return header().writer_waiting.exchange(false); }
+
+private:
+    struct Header {
+        AK_CACHE_ALIGNED Atomic<u64> write_offset { 0 };
+        AK_CACHE_ALIGNED Atomic<u64> read_offset { 0 };
+        AK_CACHE_ALIGNED Atomic<bool> reader_waiting { false };
+        Atomic<bool> writer_waiting { false };
+        Atomic<bool> closed_for_writing { false };
+    };
+
+    static constexpr size_t data_offset = sizeof(Header);
+
+    SharedRingBuffer(AnonymousBuffer buffer, size_t capacity)
+        : m_buffer(move(buffer))
+        , m_capacity(capacity)
+    {
+    }
+
+    Header& header() { return *reinterpret_cast<Header*>(m_buffer.data<void>()); }
+    Header const& header() const { return *reinterpret_cast<Header const*>(m_buffer.data<void>()); }
+    u8* data() { return m_buffer.data<u8>() + data_offset; }
+    u8 const* data() const { return m_buffer.data<u8>() + data_offset; }
+
+    size_t used_size(u64 write_offset, u64 read_offset) const;
+
+    AnonymousBuffer m_buffer;
+    size_t m_capacity { 0 };
+};
+
+}
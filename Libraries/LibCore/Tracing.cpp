@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCore/Tracing.h>
+#include <LibThreading/Mutex.h>
+
+namespace Core {
+
+Atomic<bool> Tracing::s_enabled { false };
+
+// Bound the memory used by a trace that is left running for a long time. This is roughly 64 MiB worth of events.
+static constexpr size_t MAX_RECORDED_EVENTS = 1'000'000;
+
+struct TraceEvent {
+    StringView category;
+    StringView name;
+    MonotonicTime start_time;
+    AK::Duration duration;
+    u32 thread_id { 0 };
+};
+
+static Threading::Mutex s_mutex;
+static Vector<TraceEvent> s_events;
+static Optional<MonotonicTime> s_trace_start_time;
+static bool s_did_drop_events { false };
+
+static u32 current_thread_id()
+{
+    static Atomic<u32> s_next_thread_id { 1 };
+    thread_local u32 s_thread_id = s_next_thread_id.fetch_add(1);
+    return s_thread_id;
+}
+
+void Tracing::start()
+{
+    Threading::MutexLocker locker { s_mutex };
+
+    s_events.clear_with_capacity();
+    s_trace_start_time = MonotonicTime::now();
+    s_did_drop_events = false;
+
+    s_enabled.store(true, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void Tracing::record_complete_event(StringView category, StringView name, MonotonicTime start_time, MonotonicTime end_time)
+{
+    auto thread_id = current_thread_id();
+
+    Threading::MutexLocker locker { s_mutex };
+
+    if (!is_enabled())
+        return;
+
+    if (s_events.size() >= MAX_RECORDED_EVENTS) {
+        s_did_drop_events = true;
+        return;
+    }
+
+    s_events.append({ category, name, start_time, end_time - start_time, thread_id });
+}
+
+ErrorOr<void> Tracing::stop_and_write_to_file(StringView path)
+{
+    Vector<TraceEvent> events;
+    MonotonicTime trace_start_time = MonotonicTime::now();
+
+    {
+        Threading::MutexLocker locker { s_mutex };
+        s_enabled.store(false, AK::MemoryOrder::memory_order_relaxed);
+
+        events = move(s_events);
+        trace_start_time = s_trace_start_time.value_or(trace_start_time);
+
+        if (s_did_drop_events)
+            dbgln("Tracing: Trace buffer was full, {} events were recorded before dropping further events", events.size());
+    }
+
+    auto process_id = System::getpid();
+
+    StringBuilder builder;
+    builder.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["sv);
+
+    for (size_t i = 0; i < events.size(); ++i) {
+        auto const& event = events[i];
+
+        if (i != 0)
+            builder.append(',');
+
+        // Chrome trace timestamps and durations are in microseconds.
+        builder.appendff(R"({{"cat":"{}","name":"{}","ph":"X","ts":{},"dur":{},"pid":{},"tid":{}}})",
+            event.category,
+            event.name,
+            (event.start_time - trace_start_time).to_microseconds(),
+            event.duration.to_microseconds(),
+            process_id,
+            event.thread_id);
+    }
+
+    builder.append("]}"sv);
+
+    auto file = TRY(File::open(path, File::OpenMode::Write | File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(builder.string_view().bytes()));
+
+    return {};
+}
+
+}
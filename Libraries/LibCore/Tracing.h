@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+
+namespace Core {
+
+// A process-wide recorder of timed events, which can be written out in the Chrome Trace Event Format for viewing in
+// Perfetto or chrome://tracing. Recording is off by default, in which case a ScopedTraceEvent costs a single relaxed
+// atomic load.
+class Tracing {
+public:
+    static bool is_enabled() { return s_enabled.load(AK::MemoryOrder::memory_order_relaxed); }
+
+    // Discards any previously recorded events and starts recording.
+    static void start();
+
+    // Stops recording and writes all recorded events to the given path as Chrome trace JSON.
+    static ErrorOr<void> stop_and_write_to_file(StringView path);
+
+    // Category and name must outlive the recording, i.e. they should be string literals.
+    static void record_complete_event(StringView category, StringView name, MonotonicTime start_time, MonotonicTime end_time);
+
+private:
+    static Atomic<bool> s_enabled;
+};
+
+class ScopedTraceEvent {
+    AK_MAKE_NONCOPYABLE(ScopedTraceEvent);
+    AK_MAKE_NONMOVABLE(ScopedTraceEvent);
+
+public:
+    ScopedTraceEvent(StringView category, StringView name)
+        : m_category(category)
+        , m_name(name)
+    {
+        if (Tracing::is_enabled()) [[unlikely]]
+            m_start_time = MonotonicTime::now();
+    }
+
+    ~ScopedTraceEvent()
+    {
+        if (m_start_time.has_value()) [[unlikely]]
+            Tracing::record_complete_event(m_category, m_name, *m_start_time, MonotonicTime::now());
+    }
+
+private:
+    StringView m_category;
+    StringView m_name;
+    Optional<MonotonicTime> m_start_time;
+};
+
+}
@@ -23,6 +23,7 @@
 #include <LibCrypto/Curves/EdwardsCurve.h>
 #include <LibCrypto/PK/RSA.h>
 #include <LibDNS/Message.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibThreading/RWLockProtected.h>
 
 #define TRY_OR_REJECT_PROMISE(promise, expr)          \
@@ -96,10 +97,29 @@ public:
             }
         }
 
-        if (m_cached_records.is_empty() && m_request_done)
+        m_negative_answers.remove_all_matching([&](auto, auto const& expiration) {
+            return expiration < now;
+        });
+
+        if (m_cached_records.is_empty() && m_negative_answers.is_empty() && m_request_done)
             m_valid = false;
     }
 
+    // Whether any of the records is about to expire, in which case the lookup should be refreshed before it does.
+    bool is_close_to_expiration() const
+    {
+        auto now = AK::UnixDateTime::now();
+        for (auto const& re : m_cached_records) {
+            if (!re.expiration.has_value())
+                continue;
+
+            auto refresh_window = max(AK::Duration::from_seconds(re.record.ttl / 10), AK::Duration::from_seconds(1));
+            if (re.expiration.value() - now < refresh_window)
+                return true;
+        }
+        return false;
+    }
+
     void add_record(Messages::ResourceRecord record)
     {
         m_valid = true;
@@ -144,6 +164,32 @@ public:
         VERIFY_NOT_REACHED();
     }
 
+    // A negative answer tells us that there are no records of the given type (RFC 2308), which we can cache as well.
+    void add_negative_answer(Messages::ResourceType type, u32 ttl)
+    {
+        m_valid = true;
+        m_negative_answers.set(type, AK::UnixDateTime::now() + AK::Duration::from_seconds(ttl));
+    }
+
+    bool has_answer_for_type(Messages::ResourceType type) const
+    {
+        return has_record_of_type(type) || m_negative_answers.contains(type);
+    }
+
+    Vector<Messages::ResourceType> answered_types() const
+    {
+        Vector<Messages::ResourceType> types;
+        for (auto const& re : m_cached_records) {
+            if (!types.contains_slow(re.record.type))
+                types.append(re.record.type);
+        }
+        for (auto const& it : m_negative_answers) {
+            if (!types.contains_slow(it.key))
+                types.append(it.key);
+        }
+        return types;
+    }
+
     bool has_record_of_type(Messages::ResourceType type, bool later = false) const
     {
         if (later && m_desired_types.contains(type))
@@ -190,6 +236,7 @@ private:
     };
 
     Vector<RecordWithExpiration> m_cached_records;
+    HashMap<Messages::ResourceType, AK::UnixDateTime> m_negative_answers;
     HashTable<Messages::ResourceType> m_desired_types;
     Vector<Messages::Records::DNSKEY> m_used_dnskeys {};
     HashTable<u16> m_seen_key_tags;
@@ -217,6 +264,9 @@ public:
         bool validate_dnssec_locally { false };
         PendingLookup* repeating_lookup { nullptr };
 
+        // Don't serve the lookup from the cache, e.g. because the cached result is about to expire.
+        bool bypass_cache { false };
+
         static LookupOptions default_() { return {}; }
     };
 
@@ -286,19 +336,25 @@ public:
 
     RefPtr<LookupResult const> lookup_in_cache(StringView name, Messages::Class, Span<Messages::ResourceType const> desired_types)
     {
-        return m_cache.with_read_locked([&](auto& cache) -> RefPtr<LookupResult const> {
-            auto it = cache.find(name);
-            if (it == cache.end())
+        auto find_result = [&](auto& results) -> RefPtr<LookupResult const> {
+            auto it = results.find(name);
+            if (it == results.end())
                 return {};
 
             auto& result = *it->value;
             for (auto const& type : desired_types) {
-                if (!result.has_record_of_type(type))
+                if (!result.has_answer_for_type(type))
                     return {};
             }
 
             return result;
-        });
+        };
+
+        if (auto result = m_cache.with_read_locked(find_result))
+            return result;
+
+        // NOTE: While a result that was about to expire is being looked up again, keep serving the previous one.
+        return m_results_being_refreshed.with_read_locked(find_result);
     }
 
     NonnullRefPtr<Core::Promise<NonnullRefPtr<LookupResult const>>> lookup(ByteString name, Messages::Class class_, Vector<Vector<Messages::ResourceType>> desired_types, LookupOptions options = LookupOptions::default_())
@@ -337,6 +393,22 @@ public:
         return lookup(move(name), class_, { Messages::ResourceType::A, Messages::ResourceType::AAAA }, options);
     }
 
+    // Looks up the addresses to connect to for the given name. The A and AAAA queries are sent out separately, as not
+    // every server answers queries with more than one question, and the lookup completes once both have been answered.
+    // FIXME: RFC 8305 (Happy Eyeballs Version 2) has connections start as soon as the first address family is known, and
+    //        adds the other family to the connection attempts once it arrives. We can't do that yet, as curl takes the
+    //        whole list of addresses when a transfer starts, so completing early would leave the request without the
+    //        other family altogether. Until then, preferring a family and racing connection attempts is left to curl.
+    NonnullRefPtr<Core::Promise<NonnullRefPtr<LookupResult const>>> lookup_addresses(ByteString name, Messages::Class class_ = Messages::Class::IN, LookupOptions options = LookupOptions::default_())
+    {
+        // NOTE: The system resolver looks up both address families at once, and address literals aren't looked up.
+        if (!has_connection() || IPv4Address::from_string(name).has_value() || IPv6Address::from_string(name).has_value())
+            return lookup(move(name), class_, options);
+
+        // NOTE: Both lookups add their records to the same cached result, which is what we resolve with.
+        return lookup(move(name), class_, Vector<Vector<Messages::ResourceType>> { { Messages::ResourceType::AAAA }, { Messages::ResourceType::A } }, options);
+    }
+
     NonnullRefPtr<Core::Promise<NonnullRefPtr<LookupResult const>>> lookup(ByteString name, Messages::Class class_, Vector<Messages::ResourceType> desired_types, LookupOptions options = LookupOptions::default_())
     {
         flush_cache();
@@ -375,10 +447,16 @@ public:
             }
         }
 
-        if (auto result = lookup_in_cache(name, class_, desired_types)) {
+        if (auto result = options.bypass_cache ? nullptr : lookup_in_cache(name, class_, desired_types)) {
             dbgln_if(DNS_DEBUG, "DNS: Resolving {} from cache...", name);
             if (!options.validate_dnssec_locally || result->is_dnssec_validated()) {
                 dbgln_if(DNS_DEBUG, "DNS: Resolved {} from cache", name);
+
+                // OPTIMIZATION: Look up results that are about to expire again in the background, so that later lookups
+                //               don't have to wait for the network once they have.
+                if (!options.validate_dnssec_locally && result->is_done() && result->is_close_to_expiration())
+                    refresh_in_background(name, class_);
+
                 promise->resolve(result.release_nonnull());
                 return promise;
             }
@@ -396,25 +474,33 @@ public:
             // Use system resolver
             // FIXME: Use an underlying resolver instead.
             dbgln_if(DNS_DEBUG, "Not ready to resolve, using system resolver and skipping cache for {}", name);
-            auto record_or_error = Core::Socket::resolve_host(name, Core::Socket::SocketType::Stream);
-            if (record_or_error.is_error()) {
-                promise->reject(record_or_error.release_error());
-                return promise;
-            }
-            auto result = make_ref_counted<LookupResult>(domain_name);
-            auto records = record_or_error.release_value();
-
-            for (auto const& record : records) {
-                record.visit(
-                    [&](IPv4Address const& address) {
-                        result->add_record({ .name = {}, .type = Messages::ResourceType::A, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::A { address }, .raw = {} });
-                    },
-                    [&](IPv6Address const& address) {
-                        result->add_record({ .name = {}, .type = Messages::ResourceType::AAAA, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::AAAA { address }, .raw = {} });
-                    });
-            }
-            result->finished_request();
-            promise->resolve(result);
+
+            // NOTE: The system resolver blocks until it has an answer, so we call it from a background thread rather
+            //       than stalling the event loop (and every other request) in the meantime.
+            using Addresses = Vector<Variant<IPv4Address, IPv6Address>>;
+            (void)Threading::BackgroundAction<Addresses>::construct(
+                [name](auto&) {
+                    return Core::Socket::resolve_host(name, Core::Socket::SocketType::Stream);
+                },
+                [promise, domain_name = move(domain_name)](Addresses records) -> ErrorOr<void> {
+                    auto result = make_ref_counted<LookupResult>(domain_name);
+
+                    for (auto const& record : records) {
+                        record.visit(
+                            [&](IPv4Address const& address) {
+                                result->add_record({ .name = {}, .type = Messages::ResourceType::A, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::A { address }, .raw = {} });
+                            },
+                            [&](IPv6Address const& address) {
+                                result->add_record({ .name = {}, .type = Messages::ResourceType::AAAA, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::AAAA { address }, .raw = {} });
+                            });
+                    }
+                    result->finished_request();
+                    promise->resolve(result);
+                    return {};
+                },
+                [promise](Error error) {
+                    promise->reject(move(error));
+                });
             return promise;
         }
 
@@ -549,7 +635,7 @@ public:
                   p->repeat_timer->set_single_shot(true);
                   p->repeat_timer->set_interval(1000);
                   p->repeat_timer->on_timeout = [=, this] {
-                      (void)lookup(name, class_, desired_types, { .validate_dnssec_locally = options.validate_dnssec_locally, .repeating_lookup = p });
+                      (void)lookup(name, class_, desired_types, { .validate_dnssec_locally = options.validate_dnssec_locally, .repeating_lookup = p, .bypass_cache = options.bypass_cache });
                   };
 
                   return nullptr;
@@ -668,6 +754,8 @@ private:
                 for (auto& record : message.answers)
                     result->add_record(move(record));
 
+                cache_negative_answers(message, *result);
+
                 result->finished_request();
                 lookup->promise->resolve(*result);
                 lookups->remove(message.header.id);
@@ -678,6 +766,71 @@ private:
         }
     }
 
+    // https://www.rfc-editor.org/rfc/rfc2308#section-5
+    static void cache_negative_answers(Messages::Message const& message, LookupResult& result)
+    {
+        auto response_code = message.header.options.response_code();
+        if (response_code != Messages::Options::ResponseCode::NoError && response_code != Messages::Options::ResponseCode::NameError)
+            return;
+
+        // The TTL of a negative answer is the minimum of the SOA record's TTL and its MINIMUM field. Negative answers
+        // without an SOA record in the authority section must not be cached.
+        Optional<u32> ttl;
+        for (auto const& record : message.authorities) {
+            if (auto const* soa = record.record.get_pointer<Messages::Records::SOA>()) {
+                ttl = min(record.ttl, soa->minimum);
+                break;
+            }
+        }
+        if (!ttl.has_value() || *ttl == 0)
+            return;
+
+        for (auto const& question : message.questions) {
+            if (response_code == Messages::Options::ResponseCode::NameError || !result.has_record_of_type(question.type)) {
+                dbgln_if(DNS_DEBUG, "DNS: Caching negative answer for {} records of {} for {}s", Messages::to_string(question.type), question.name.to_string(), *ttl);
+                result.add_negative_answer(question.type, *ttl);
+            }
+        }
+    }
+
+    void refresh_in_background(ByteString const& name, Messages::Class class_)
+    {
+        auto already_refreshing = m_results_being_refreshed.with_read_locked([&](auto& results) {
+            return results.contains(name);
+        });
+        if (already_refreshing)
+            return;
+
+        auto stale_result = m_cache.with_write_locked([&](auto& cache) {
+            return cache.take(name);
+        });
+        if (!stale_result.has_value())
+            return;
+
+        dbgln_if(DNS_DEBUG, "DNS: Refreshing {} before it expires", name);
+
+        // NOTE: Look up every type that the stale result has an answer for, rather than only the ones that this lookup
+        //       wanted, as the fresh result takes its place in the cache.
+        Vector<Vector<Messages::ResourceType>> types_to_refresh;
+        for (auto type : stale_result.value()->answered_types())
+            types_to_refresh.append({ type });
+
+        m_results_being_refreshed.with_write_locked([&](auto& results) {
+            results.set(name, stale_result.release_value());
+        });
+
+        auto refresh_done = [this, name] {
+            m_results_being_refreshed.with_write_locked([&](auto& results) {
+                results.remove(name);
+            });
+        };
+
+        // NOTE: The stale result is still served from the cache until the refresh is done, so we have to bypass it.
+        lookup(name, class_, move(types_to_refresh), { .bypass_cache = true })
+            ->when_resolved([refresh_done](auto&) { refresh_done(); })
+            .when_rejected([refresh_done](auto&) { refresh_done(); });
+    }
+
     using RRSet = Vector<Messages::ResourceRecord>;
     struct CanonicalizedRRSetWithRRSIG {
         RRSet rrset;
@@ -1195,6 +1348,7 @@ private:
     }
 
     Threading::RWLockProtected<HashMap<ByteString, NonnullRefPtr<LookupResult>>> m_cache;
+    Threading::RWLockProtected<HashMap<ByteString, NonnullRefPtr<LookupResult>>> m_results_being_refreshed;
     Threading::RWLockProtected<NonnullOwnPtr<RedBlackTree<u16, PendingLookup>>> m_pending_lookups;
     Threading::RWLockProtected<Optional<MaybeOwned<Core::Socket>>> m_socket;
     Function<ErrorOr<SocketResult>()> m_create_socket;
@@ -15,6 +15,7 @@
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
@@ -58,6 +59,8 @@ void Heap::will_allocate(size_t size)
     }
 
     m_allocated_bytes_since_last_gc += size;
+    ++m_statistics.allocated_cells;
+    m_statistics.allocated_bytes += size;
 }
 
 static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
@@ -241,12 +244,12 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
 {
     VERIFY(!m_collecting_garbage);
 
+    Core::ScopedTraceEvent trace_event { "gc"sv, "Heap::collect_garbage"sv };
+
     {
         TemporaryChange change(m_collecting_garbage, true);
 
-        Core::ElapsedTimer collection_measurement_timer;
-        if (print_report)
-            collection_measurement_timer.start();
+        auto collection_measurement_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
 
         if (collection_type == CollectionType::CollectGarbage) {
             if (m_gc_deferrals) {
@@ -259,6 +262,9 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         }
         finalize_unmarked_cells();
         sweep_dead_cells(print_report, collection_measurement_timer);
+
+        ++m_statistics.collections;
+        m_statistics.time_spent_collecting += collection_measurement_timer.elapsed_time();
     }
 
     auto tasks = move(m_post_gc_tasks);
@@ -518,6 +524,9 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
 
     m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
 
+    m_statistics.collected_cells += collected_cells;
+    m_statistics.collected_bytes += collected_cell_bytes;
+
     if (print_report) {
         AK::Duration const time_spent = measurement_timer.elapsed_time();
         size_t live_block_count = 0;
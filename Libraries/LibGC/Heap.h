@@ -14,6 +14,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -56,6 +57,26 @@ public:
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
 
+    template<typename Callback>
+    void for_each_live_cell(Callback callback)
+    {
+        for_each_block([&](auto& block) {
+            block.template for_each_cell_in_state<Cell::State::Live>(callback);
+            return IterationDecision::Continue;
+        });
+    }
+
+    // Running totals since the heap was created, for benchmarks and diagnostics.
+    struct Statistics {
+        u64 collections { 0 };
+        u64 allocated_cells { 0 };
+        u64 allocated_bytes { 0 };
+        u64 collected_cells { 0 };
+        u64 collected_bytes { 0 };
+        AK::Duration time_spent_collecting;
+    };
+    Statistics const& statistics() const { return m_statistics; }
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
@@ -141,6 +162,8 @@ private:
 
     bool m_should_collect_on_every_allocation { false };
 
+    Statistics m_statistics;
+
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
 
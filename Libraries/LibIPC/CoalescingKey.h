@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace IPC {
+
+// Identifies messages that supersede each other. If a message is posted while an earlier message with the same key is
+// still waiting to be sent, the earlier message is dropped in favor of the newer one.
+struct CoalescingKey {
+    u32 endpoint_magic { 0 };
+    i32 message_id { 0 };
+    u64 discriminator { 0 };
+
+    bool operator==(CoalescingKey const&) const = default;
+};
+
+}
@@ -11,6 +11,7 @@
 #include <LibCore/Timer.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
+#include <LibIPC/Statistics.h>
 #include <LibIPC/Stub.h>
 
 namespace IPC {
@@ -39,7 +40,12 @@ bool ConnectionBase::is_open() const
 
 ErrorOr<void> ConnectionBase::post_message(Message const& message)
 {
-    return post_message(TRY(message.encode()));
+    auto buffer = TRY(message.encode());
+
+    if (Statistics::is_enabled()) [[unlikely]]
+        Statistics::the().record_sent_message({ message.message_name(), strlen(message.message_name()) }, buffer.data().size());
+
+    return post_message(move(buffer));
 }
 
 ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
@@ -72,7 +78,25 @@ void ConnectionBase::handle_messages()
     auto messages = move(m_unprocessed_messages);
     for (auto& message : messages) {
         if (message->endpoint_magic() == m_local_endpoint_magic) {
+            Optional<MonotonicTime> handling_start_time;
+            StringView message_name;
+
+            if (Statistics::is_enabled()) [[unlikely]] {
+                handling_start_time = MonotonicTime::now();
+                message_name = { message->message_name(), strlen(message->message_name()) };
+            }
+
+            auto received_time = message->received_time();
             auto handler_result = m_local_stub.handle(move(message));
+
+            if (handling_start_time.has_value()) [[unlikely]] {
+                Optional<AK::Duration> queue_delay;
+                if (received_time.has_value())
+                    queue_delay = *handling_start_time - *received_time;
+
+                Statistics::the().record_handled_message(message_name, queue_delay, MonotonicTime::now() - *handling_start_time);
+            }
+
             if (handler_result.is_error()) {
                 dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
                 continue;
@@ -96,6 +120,11 @@ ErrorOr<void> ConnectionBase::drain_messages_from_peer()
 {
     auto schedule_shutdown = m_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
         if (auto message = try_parse_message(raw_message.bytes, raw_message.fds)) {
+            if (Statistics::is_enabled()) [[unlikely]] {
+                Statistics::the().record_received_message({ message->message_name(), strlen(message->message_name()) }, raw_message.bytes.size());
+                message->set_received_time(MonotonicTime::now());
+            }
+
             m_unprocessed_messages.append(message.release_nonnull());
         } else {
             dbgln("Failed to parse IPC message {:hex-dump}", raw_message.bytes);
@@ -14,6 +14,7 @@
 #include <LibIPC/File.h>
 #include <LibIPC/Forward.h>
 #include <LibIPC/Message.h>
+#include <LibIPC/Statistics.h>
 #include <LibIPC/Transport.h>
 
 namespace IPC {
@@ -75,18 +76,35 @@ public:
     template<typename RequestType, typename... Args>
     NonnullOwnPtr<typename RequestType::ResponseType> send_sync(Args&&... args)
     {
+        Optional<MonotonicTime> start_time;
+        if (Statistics::is_enabled()) [[unlikely]]
+            start_time = MonotonicTime::now();
+
         MUST(post_message(RequestType(forward<Args>(args)...)));
         auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
         VERIFY(response);
+
+        if (start_time.has_value()) [[unlikely]]
+            Statistics::the().record_synchronous_round_trip(RequestType::static_message_name(), MonotonicTime::now() - *start_time);
+
         return response.release_nonnull();
     }
 
     template<typename RequestType, typename... Args>
     OwnPtr<typename RequestType::ResponseType> send_sync_but_allow_failure(Args&&... args)
     {
+        Optional<MonotonicTime> start_time;
+        if (Statistics::is_enabled()) [[unlikely]]
+            start_time = MonotonicTime::now();
+
         if (post_message(RequestType(forward<Args>(args)...)).is_error())
             return nullptr;
-        return wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+
+        if (response && start_time.has_value()) [[unlikely]]
+            Statistics::the().record_synchronous_round_trip(RequestType::static_message_name(), MonotonicTime::now() - *start_time);
+
+        return response;
     }
 
 protected:
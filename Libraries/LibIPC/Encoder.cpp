@@ -12,6 +12,7 @@
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/NumericLimits.h>
+#include <AK/ScopeGuard.h>
 #include <AK/String.h>
 #include <AK/Time.h>
 #include <LibCore/AnonymousBuffer.h>
@@ -20,6 +21,7 @@
 #include <LibCore/System.h>
 #include <LibIPC/Encoder.h>
 #include <LibIPC/File.h>
+#include <LibIPC/LargeBytes.h>
 #include <LibURL/Origin.h>
 #include <LibURL/URL.h>
 
@@ -32,6 +34,28 @@ ErrorOr<void> Encoder::encode_size(size_t size)
     return encode(static_cast<u32>(size));
 }
 
+ErrorOr<void> Encoder::encode_large_bytes(ReadonlyBytes bytes)
+{
+    if (bytes.size() < LargeBytes::shared_memory_threshold) {
+        TRY(encode(false));
+        TRY(encode_size(bytes.size()));
+        TRY(append(bytes.data(), bytes.size()));
+        return {};
+    }
+
+    auto buffer = TRY(SharedMemoryPool::the().acquire(bytes.size()));
+    ArmedScopeGuard release_buffer = [&] { SharedMemoryPool::the().release(buffer); };
+
+    bytes.copy_to({ buffer.data<u8>() + LargeBytes::shared_memory_header_size, bytes.size() });
+
+    TRY(encode(true));
+    TRY(encode(buffer));
+    TRY(encode_size(bytes.size()));
+
+    release_buffer.disarm();
+    return {};
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, float const& value)
 {
@@ -58,6 +58,11 @@ public:
 
     ErrorOr<void> encode_size(size_t size);
 
+    // Encodes a payload that the peer decodes as an IPC::LargeBytes. Large payloads are copied once into a pooled shared
+    // memory buffer that is passed to the peer by file descriptor, rather than being copied into the message buffer and
+    // streamed through the transport. Smaller payloads are encoded inline, as mapping the buffer would cost more.
+    ErrorOr<void> encode_large_bytes(ReadonlyBytes);
+
 private:
     MessageBuffer& m_buffer;
 };
@@ -13,6 +13,7 @@ namespace IPC {
 class AutoCloseFileDescriptor;
 class Decoder;
 class Encoder;
+class LargeBytes;
 class Message;
 class MessageBuffer;
 class File;
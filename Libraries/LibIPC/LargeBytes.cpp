@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibIPC/LargeBytes.h>
+
+namespace IPC {
+
+// Larger payloads get a buffer of their own, so that we don't hold on to a lot of memory after sending them.
+static constexpr size_t maximum_pooled_buffer_size = 4 * MiB;
+static constexpr size_t maximum_pooled_buffer_count = 8;
+
+// Pooled buffers are rounded up to this granularity, so that they can be reused for payloads of a similar size.
+static constexpr size_t pooled_buffer_granularity = 256 * KiB;
+
+static u32 volatile* in_use_flag(Core::AnonymousBuffer& buffer)
+{
+    return reinterpret_cast<u32 volatile*>(buffer.data<u8>());
+}
+
+ErrorOr<LargeBytes> LargeBytes::create_from_shared_memory(Core::AnonymousBuffer buffer, size_t size)
+{
+    if (!buffer.is_valid() || buffer.size() < shared_memory_header_size || buffer.size() - shared_memory_header_size < size)
+        return Error::from_string_literal("Invalid shared memory buffer for large payload");
+
+    return LargeBytes { adopt_ref(*new SharedPayload(move(buffer), size)) };
+}
+
+LargeBytes::SharedPayload::~SharedPayload()
+{
+    AK::atomic_store(in_use_flag(m_buffer), 0u, AK::memory_order_release);
+}
+
+ReadonlyBytes LargeBytes::bytes() const
+{
+    return m_storage.visit(
+        [](ByteBuffer const& buffer) { return buffer.bytes(); },
+        [](NonnullRefPtr<SharedPayload> const& payload) { return payload->bytes(); });
+}
+
+ErrorOr<ByteBuffer> LargeBytes::release_byte_buffer()
+{
+    if (m_storage.has<ByteBuffer>())
+        return move(m_storage.get<ByteBuffer>());
+    return ByteBuffer::copy(bytes());
+}
+
+SharedMemoryPool& SharedMemoryPool::the()
+{
+    static SharedMemoryPool pool;
+    return pool;
+}
+
+ErrorOr<Core::AnonymousBuffer> SharedMemoryPool::acquire(size_t payload_size)
+{
+    auto buffer_size = LargeBytes::shared_memory_header_size + payload_size;
+    auto is_poolable = buffer_size <= maximum_pooled_buffer_size;
+
+    Threading::MutexLocker locker { m_mutex };
+
+    if (is_poolable) {
+        for (auto& buffer : m_buffers) {
+            if (buffer.size() < buffer_size)
+                continue;
+
+            // The receiver clears the flag once it has unmapped the buffer. If it never does (e.g. because it went
+            // away before receiving the message), the buffer simply stays in use.
+            u32 expected = 0;
+            if (AK::atomic_compare_exchange_strong(in_use_flag(buffer), expected, 1u, AK::memory_order_acquire))
+                return buffer;
+        }
+    }
+
+    auto should_pool = is_poolable && m_buffers.size() < maximum_pooled_buffer_count;
+    if (should_pool)
+        buffer_size = round_up_to_power_of_two(buffer_size, pooled_buffer_granularity);
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(buffer_size));
+    AK::atomic_store(in_use_flag(buffer), 1u, AK::memory_order_relaxed);
+
+    if (should_pool)
+        TRY(m_buffers.try_append(buffer));
+
+    return buffer;
+}
+
+void SharedMemoryPool::release(Core::AnonymousBuffer& buffer)
+{
+    AK::atomic_store(in_use_flag(buffer), 0u, AK::memory_order_release);
+}
+
+size_t SharedMemoryPool::pooled_buffer_count() const
+{
+    Threading::MutexLocker locker { m_mutex };
+    return m_buffers.size();
+}
+
+template<>
+ErrorOr<void> encode(Encoder& encoder, LargeBytes const& bytes)
+{
+    return encoder.encode_large_bytes(bytes.bytes());
+}
+
+template<>
+ErrorOr<LargeBytes> decode(Decoder& decoder)
+{
+    if (auto is_in_shared_memory = TRY(decoder.decode<bool>()); !is_in_shared_memory)
+        return LargeBytes { TRY(decoder.decode<ByteBuffer>()) };
+
+    auto buffer = TRY(decoder.decode<Core::AnonymousBuffer>());
+    auto size = TRY(decoder.decode_size());
+
+    return LargeBytes::create_from_shared_memory(move(buffer), size);
+}
+
+}
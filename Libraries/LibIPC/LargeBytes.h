@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/Variant.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibIPC/Forward.h>
+#include <LibThreading/Mutex.h>
+
+namespace IPC {
+
+// A byte payload that is passed to the peer through shared memory once it is large enough, rather than being copied
+// into the message and streamed through the transport. The receiver reads the payload straight out of the mapping.
+//
+// Senders should pass the bytes as a ReadonlyBytes parameter, which is encoded with Encoder::encode_large_bytes().
+//
+// NOTE: The peer can still write to the shared memory while we are reading it, so the payload must be treated as
+//       bytes that may change under us. Don't validate it and then read it again; copy it first if that's needed.
+class LargeBytes {
+public:
+    // Payloads at or above this size are placed in shared memory.
+    static constexpr size_t shared_memory_threshold = 64 * KiB;
+
+    // Each shared memory buffer starts with a flag that tells the sender whether the receiver is still using it.
+    static constexpr size_t shared_memory_header_size = 64;
+
+    LargeBytes() = default;
+
+    LargeBytes(ByteBuffer buffer)
+        : m_storage(move(buffer))
+    {
+    }
+
+    static ErrorOr<LargeBytes> create_from_shared_memory(Core::AnonymousBuffer, size_t size);
+
+    ReadonlyBytes bytes() const;
+    operator ReadonlyBytes() const { return bytes(); }
+
+    size_t size() const { return bytes().size(); }
+    bool is_empty() const { return size() == 0; }
+
+    bool is_in_shared_memory() const { return m_storage.has<NonnullRefPtr<SharedPayload>>(); }
+
+    // Returns the payload as a ByteBuffer. This only copies the payload if it is in shared memory.
+    ErrorOr<ByteBuffer> release_byte_buffer();
+
+private:
+    // Keeps the shared memory mapped, and tells the sender that it may reuse the buffer once we are done with it.
+    class SharedPayload : public RefCounted<SharedPayload> {
+    public:
+        SharedPayload(Core::AnonymousBuffer buffer, size_t size)
+            : m_buffer(move(buffer))
+            , m_size(size)
+        {
+        }
+
+        ~SharedPayload();
+
+        ReadonlyBytes bytes() const { return { m_buffer.data<u8>() + shared_memory_header_size, m_size }; }
+
+    private:
+        Core::AnonymousBuffer m_buffer;
+        size_t m_size { 0 };
+    };
+
+    explicit LargeBytes(NonnullRefPtr<SharedPayload> payload)
+        : m_storage(move(payload))
+    {
+    }
+
+    Variant<ByteBuffer, NonnullRefPtr<SharedPayload>> m_storage { ByteBuffer {} };
+};
+
+// Hands out shared memory buffers for payloads that are sent with Encoder::encode_large_bytes(). Buffers that the
+// receiver has released are reused for later payloads, so that we don't have to create and map a new buffer for each
+// message.
+class SharedMemoryPool {
+public:
+    static SharedMemoryPool& the();
+
+    // Returns a buffer with room for a payload of the given size, which is marked as being in use by the receiver.
+    ErrorOr<Core::AnonymousBuffer> acquire(size_t payload_size);
+
+    // Hands a buffer back to the pool that never made it to the receiver, e.g. because the message couldn't be encoded.
+    void release(Core::AnonymousBuffer&);
+
+    size_t pooled_buffer_count() const;
+
+private:
+    SharedMemoryPool() = default;
+
+    mutable Threading::Mutex m_mutex;
+    Vector<Core::AnonymousBuffer> m_buffers;
+};
+
+template<>
+ErrorOr<void> encode(Encoder&, LargeBytes const&);
+
+template<>
+ErrorOr<LargeBytes> decode(Decoder&);
+
+}
@@ -39,6 +39,7 @@ ErrorOr<void> MessageBuffer::extend(MessageBuffer&& buffer)
 {
     TRY(m_data.try_extend(move(buffer.m_data)));
     TRY(m_fds.try_extend(move(buffer.m_fds)));
+    m_coalescing_key.clear();
     return {};
 }
 
@@ -49,7 +50,7 @@ ErrorOr<void> MessageBuffer::transfer_message(Transport& transport)
         return Error::from_string_literal("Message is too large for IPC encoding");
     }
 
-    transport.post_message(m_data, m_fds);
+    transport.post_message(m_data, m_fds, m_coalescing_key);
     return {};
 }
 
@@ -8,8 +8,11 @@
 #pragma once
 
 #include <AK/Error.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibIPC/AutoCloseFileDescriptor.h>
+#include <LibIPC/CoalescingKey.h>
 #include <LibIPC/Forward.h>
 #include <LibIPC/Transport.h>
 
@@ -40,9 +43,13 @@ public:
     MessageFileType const& fds() const { return m_fds; }
     MessageFileType take_fds() { return move(m_fds); }
 
+    Optional<CoalescingKey> const& coalescing_key() const { return m_coalescing_key; }
+    void set_coalescing_key(CoalescingKey key) { m_coalescing_key = key; }
+
 private:
     MessageDataType m_data;
     MessageFileType m_fds;
+    Optional<CoalescingKey> m_coalescing_key;
 #ifdef AK_OS_WINDOWS
     Vector<size_t> m_handle_offsets;
 #endif
@@ -64,8 +71,15 @@ public:
     virtual char const* message_name() const = 0;
     virtual ErrorOr<MessageBuffer> encode() const = 0;
 
+    // Only set while IPC statistics are enabled, to measure how long the message waits before it is handled.
+    Optional<MonotonicTime> const& received_time() const { return m_received_time; }
+    void set_received_time(MonotonicTime received_time) { m_received_time = received_time; }
+
 protected:
     Message() = default;
+
+private:
+    Optional<MonotonicTime> m_received_time;
 };
 
 }
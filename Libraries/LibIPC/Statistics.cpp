@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <LibIPC/Statistics.h>
+#include <signal.h>
+
+namespace IPC {
+
+bool Statistics::s_enabled { false };
+
+void Statistics::enable()
+{
+    if (s_enabled)
+        return;
+    s_enabled = true;
+
+#if !defined(AK_OS_WINDOWS)
+    Core::EventLoop::register_signal(SIGUSR1, [](int) {
+        if (auto path = the().dump(); path.is_error())
+            dbgln("Unable to dump IPC statistics: {}", path.error());
+        else
+            dbgln("Dumped IPC statistics to {}", path.value());
+    });
+#endif
+}
+
+Statistics& Statistics::the()
+{
+    static Statistics statistics;
+    return statistics;
+}
+
+void Statistics::Histogram::record(AK::Duration duration)
+{
+    auto microseconds = static_cast<u64>(max(duration.to_microseconds(), 0));
+    auto bucket = microseconds == 0 ? 0uz : static_cast<size_t>(64 - count_leading_zeroes(microseconds));
+
+    ++count;
+    total += duration;
+    maximum = max(maximum, duration);
+    ++buckets[min(bucket, buckets.size() - 1)];
+}
+
+void Statistics::record_sent_message(StringView message_name, size_t size)
+{
+    Threading::MutexLocker locker { m_mutex };
+
+    auto& statistics = m_messages.ensure(message_name);
+    ++statistics.sent_count;
+    statistics.sent_bytes += size;
+}
+
+void Statistics::record_received_message(StringView message_name, size_t size)
+{
+    Threading::MutexLocker locker { m_mutex };
+
+    auto& statistics = m_messages.ensure(message_name);
+    ++statistics.received_count;
+    statistics.received_bytes += size;
+}
+
+void Statistics::record_handled_message(StringView message_name, Optional<AK::Duration> queue_delay, AK::Duration handling_time)
+{
+    Threading::MutexLocker locker { m_mutex };
+
+    auto& statistics = m_messages.ensure(message_name);
+    if (queue_delay.has_value())
+        statistics.queue_delay.record(*queue_delay);
+    statistics.handling_time.record(handling_time);
+}
+
+void Statistics::record_synchronous_round_trip(StringView message_name, AK::Duration round_trip_time)
+{
+    Threading::MutexLocker locker { m_mutex };
+
+    auto& statistics = m_messages.ensure(message_name);
+    statistics.round_trip_time.record(round_trip_time);
+}
+
+static JsonObject serialize_histogram(auto const& histogram)
+{
+    JsonObject object;
+    object.set("count"sv, histogram.count);
+    object.set("total_us"sv, histogram.total.to_microseconds());
+    object.set("max_us"sv, histogram.maximum.to_microseconds());
+
+    JsonArray buckets;
+    for (size_t i = 0; i < histogram.buckets.size(); ++i) {
+        if (histogram.buckets[i] == 0)
+            continue;
+
+        JsonObject bucket;
+        bucket.set("upper_bound_us"sv, static_cast<u64>(1) << i);
+        bucket.set("count"sv, histogram.buckets[i]);
+        buckets.must_append(move(bucket));
+    }
+    object.set("buckets"sv, move(buckets));
+
+    return object;
+}
+
+ByteString Statistics::serialize_as_json() const
+{
+    Threading::MutexLocker locker { m_mutex };
+
+    // Message names have the form "Endpoint::Message", so group them by endpoint.
+    JsonObject endpoints;
+
+    for (auto const& [message_name, statistics] : m_messages) {
+        auto separator = message_name.find("::"sv);
+        auto endpoint_name = separator.has_value() ? message_name.substring_view(0, *separator) : "Unknown"sv;
+        auto short_name = separator.has_value() ? message_name.substring_view(*separator + 2) : message_name;
+
+        JsonObject message;
+        message.set("sent_count"sv, statistics.sent_count);
+        message.set("sent_bytes"sv, statistics.sent_bytes);
+        message.set("received_count"sv, statistics.received_count);
+        message.set("received_bytes"sv, statistics.received_bytes);
+        if (statistics.queue_delay.count > 0)
+            message.set("queue_delay"sv, serialize_histogram(statistics.queue_delay));
+        if (statistics.handling_time.count > 0)
+            message.set("handling_time"sv, serialize_histogram(statistics.handling_time));
+        if (statistics.round_trip_time.count > 0)
+            message.set("round_trip_time"sv, serialize_histogram(statistics.round_trip_time));
+
+        if (!endpoints.has_object(endpoint_name))
+            endpoints.set(endpoint_name, JsonObject {});
+        endpoints.get_object(endpoint_name)->set(short_name, move(message));
+    }
+
+    JsonObject object;
+    object.set("pid"sv, Core::System::getpid());
+    object.set("endpoints"sv, move(endpoints));
+
+    return object.serialized().to_byte_string();
+}
+
+ErrorOr<ByteString> Statistics::dump() const
+{
+    auto path = ByteString::formatted("{}/ipc-statistics-{}.json", Core::StandardPaths::tempfile_directory(), Core::System::getpid());
+
+    auto json = serialize_as_json();
+
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(json.bytes()));
+
+    return path;
+}
+
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/Time.h>
+#include <LibThreading/Mutex.h>
+
+namespace IPC {
+
+// Collects per-message traffic and latency statistics for all IPC connections in this process. Recording is disabled by
+// default, and all call sites are expected to check is_enabled() before doing any work.
+class Statistics {
+public:
+    static bool is_enabled() { return s_enabled; }
+
+    // Enables recording, and dumps the statistics collected so far whenever the process receives SIGUSR1. This must be
+    // called after the main event loop has been created.
+    static void enable();
+
+    static Statistics& the();
+
+    void record_sent_message(StringView message_name, size_t size);
+    void record_received_message(StringView message_name, size_t size);
+    void record_handled_message(StringView message_name, Optional<AK::Duration> queue_delay, AK::Duration handling_time);
+    void record_synchronous_round_trip(StringView message_name, AK::Duration);
+
+    ByteString serialize_as_json() const;
+
+    // Writes the statistics to a JSON file in the temporary directory, and returns its path.
+    ErrorOr<ByteString> dump() const;
+
+private:
+    Statistics() = default;
+
+    // Durations are bucketed by powers of two in microseconds, i.e. bucket N counts durations in [2^(N-1), 2^N).
+    struct Histogram {
+        void record(AK::Duration);
+
+        u64 count { 0 };
+        AK::Duration total;
+        AK::Duration maximum;
+        Array<u64, 32> buckets {};
+    };
+
+    struct MessageStatistics {
+        u64 sent_count { 0 };
+        u64 sent_bytes { 0 };
+        u64 received_count { 0 };
+        u64 received_bytes { 0 };
+        Histogram queue_delay;
+        Histogram handling_time;
+        Histogram round_trip_time;
+    };
+
+    // Message names are always string literals generated by the IPC compiler, so we can key on views of them.
+    HashMap<StringView, MessageStatistics> m_messages;
+    mutable Threading::Mutex m_mutex;
+
+    static bool s_enabled;
+};
+
+}
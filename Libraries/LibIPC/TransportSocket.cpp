@@ -12,18 +12,44 @@
 
 namespace IPC {
 
-void SendQueue::enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds)
+void SendQueue::enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds, Optional<CoalescingKey> coalescing_key)
 {
     Threading::MutexLocker locker(m_mutex);
-    VERIFY(MUST(m_stream.write_some(bytes.span())) == bytes.size());
-    m_fds.append(fds.data(), fds.size());
+
+    if (coalescing_key.has_value() && m_coalescable_message.has_value() && m_coalescable_message->key == *coalescing_key) {
+        // The send thread has already been signaled for the message we are replacing.
+        m_coalescable_message->bytes = move(bytes);
+        return;
+    }
+
+    flush_coalescable_message();
+
+    if (coalescing_key.has_value()) {
+        VERIFY(fds.is_empty());
+        m_coalescable_message = CoalescableMessage { *coalescing_key, move(bytes) };
+    } else {
+        VERIFY(MUST(m_stream.write_some(bytes.span())) == bytes.size());
+        m_fds.append(fds.data(), fds.size());
+    }
+
     m_condition.signal();
 }
 
+void SendQueue::flush_coalescable_message()
+{
+    if (!m_coalescable_message.has_value())
+        return;
+
+    auto bytes = move(m_coalescable_message->bytes);
+    m_coalescable_message.clear();
+
+    VERIFY(MUST(m_stream.write_some(bytes.span())) == bytes.size());
+}
+
 SendQueue::Running SendQueue::block_until_message_enqueued()
 {
     Threading::MutexLocker locker(m_mutex);
-    while (m_stream.is_eof() && m_fds.is_empty() && m_running)
+    while (m_stream.is_eof() && m_fds.is_empty() && !m_coalescable_message.has_value() && m_running)
         m_condition.wait();
     return m_running ? Running::Yes : Running::No;
 }
@@ -31,6 +57,8 @@ SendQueue::Running SendQueue::block_until_message_enqueued()
 SendQueue::BytesAndFds SendQueue::peek(size_t max_bytes)
 {
     Threading::MutexLocker locker(m_mutex);
+    flush_coalescable_message();
+
     BytesAndFds result;
     auto bytes_to_send = min(max_bytes, m_stream.used_buffer_size());
     result.bytes.resize(bytes_to_send);
@@ -67,7 +95,7 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
             if (send_queue->block_until_message_enqueued() == SendQueue::Running::No)
                 break;
 
-            auto [bytes, fds] = send_queue->peek(4096);
+            auto [bytes, fds] = send_queue->peek(MAX_SEND_BATCH_SIZE);
             ReadonlyBytes remaining_bytes_to_send = bytes;
 
             if (transfer_data(remaining_bytes_to_send, fds) == TransferState::SocketClosed)
@@ -162,7 +190,7 @@ struct MessageHeader {
     }
 };
 
-void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const& fds)
+void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const& fds, Optional<CoalescingKey> coalescing_key)
 {
     auto num_fds_to_transfer = fds.size();
 
@@ -185,7 +213,11 @@ void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<Nonn
         }
     }
 
-    m_send_queue->enqueue_message(move(message_buffer), move(raw_fds));
+    // Messages carrying file descriptors are never coalesced, as every descriptor must be acknowledged by the peer.
+    if (num_fds_to_transfer > 0)
+        coalescing_key.clear();
+
+    m_send_queue->enqueue_message(move(message_buffer), move(raw_fds), coalescing_key);
 }
 
 ErrorOr<void> TransportSocket::send_message(Core::LocalSocket& socket, ReadonlyBytes& bytes_to_write, Vector<int>& unowned_fds)
@@ -242,7 +274,8 @@ TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& byt
     if (!m_socket->is_open())
         return TransferState::SocketClosed;
 
-    {
+    // Only wait for the socket to become writable if it could not accept everything we had to send.
+    if (!bytes.is_empty()) {
         Vector<struct pollfd, 1> pollfds;
         pollfds.append({ .fd = m_socket->fd().value(), .events = POLLOUT, .revents = 0 });
 
@@ -11,6 +11,7 @@
 #include <AK/Queue.h>
 #include <LibCore/Socket.h>
 #include <LibIPC/AutoCloseFileDescriptor.h>
+#include <LibIPC/CoalescingKey.h>
 #include <LibIPC/File.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/MutexProtected.h>
@@ -28,7 +29,7 @@ public:
     Running block_until_message_enqueued();
     void stop();
 
-    void enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds);
+    void enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds, Optional<CoalescingKey> = {});
     struct BytesAndFds {
         Vector<u8> bytes;
         Vector<int> fds;
@@ -37,8 +38,19 @@ public:
     void discard(size_t bytes_count, size_t fds_count);
 
 private:
+    void flush_coalescable_message();
+
     AllocatingMemoryStream m_stream;
     Vector<int> m_fds;
+
+    // The most recently enqueued message, held back from the stream while it may still be superseded by a newer
+    // message with the same coalescing key. It is flushed to the stream once the send thread is ready for more data.
+    struct CoalescableMessage {
+        CoalescingKey key;
+        Vector<u8> bytes;
+    };
+    Optional<CoalescableMessage> m_coalescable_message;
+
     Threading::Mutex m_mutex;
     Threading::ConditionVariable m_condition { m_mutex };
     bool m_running { true };
@@ -51,6 +63,9 @@ class TransportSocket {
 public:
     static constexpr socklen_t SOCKET_BUFFER_SIZE = 128 * KiB;
 
+    // Queued messages are written to the socket in batches of up to this many bytes.
+    static constexpr size_t MAX_SEND_BATCH_SIZE = 64 * KiB;
+
     explicit TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket);
     ~TransportSocket();
 
@@ -62,7 +77,7 @@ public:
 
     void wait_until_readable();
 
-    void post_message(Vector<u8> const&, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const&);
+    void post_message(Vector<u8> const&, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const&, Optional<CoalescingKey> = {});
 
     enum class ShouldShutdown {
         No,
@@ -316,6 +316,11 @@ public:
     }
 
     Vector<NonnullRefPtr<Statement const>> const& children() const { return m_children; }
+
+    // NOTE: The statements are only needed to generate bytecode, so they can be released once that's cached. Declarations
+    //       are kept, as they're needed for declaration instantiation.
+    void release_children() { m_children.clear(); }
+
     virtual void dump(int indent) const override;
     virtual Bytecode::CodeGenerationErrorOr<Optional<Bytecode::ScopedOperand>> generate_bytecode(Bytecode::Generator&, Optional<Bytecode::ScopedOperand> preferred_dst = {}) const override;
 
@@ -0,0 +1,478 @@
+// An incremental one-way constraint solver, after the DeltaBlue benchmark by John Maloney and Mario Wolczko.
+// Exercises polymorphic method calls through a class hierarchy, array growth and short-lived allocations.
+
+class Strength {
+    constructor(value, name) {
+        this.value = value;
+        this.name = name;
+    }
+
+    static stronger(s1, s2) {
+        return s1.value < s2.value;
+    }
+
+    static weaker(s1, s2) {
+        return s1.value > s2.value;
+    }
+
+    static weakest(s1, s2) {
+        return Strength.weaker(s1, s2) ? s1 : s2;
+    }
+
+    nextWeaker() {
+        switch (this.value) {
+            case 0:
+                return Strength.WEAKEST;
+            case 1:
+                return Strength.WEAK_DEFAULT;
+            case 2:
+                return Strength.NORMAL;
+            case 3:
+                return Strength.STRONG_DEFAULT;
+            case 4:
+                return Strength.PREFERRED;
+            case 5:
+                return Strength.REQUIRED;
+        }
+    }
+}
+
+Strength.REQUIRED = new Strength(0, "required");
+Strength.STRONG_PREFERRED = new Strength(1, "strongPreferred");
+Strength.PREFERRED = new Strength(2, "preferred");
+Strength.STRONG_DEFAULT = new Strength(3, "strongDefault");
+Strength.NORMAL = new Strength(4, "normal");
+Strength.WEAK_DEFAULT = new Strength(5, "weakDefault");
+Strength.WEAKEST = new Strength(6, "weakest");
+
+let planner = null;
+
+class Constraint {
+    constructor(strength) {
+        this.strength = strength;
+    }
+
+    addConstraint() {
+        this.addToGraph();
+        planner.incrementalAdd(this);
+    }
+
+    satisfy(mark) {
+        this.chooseMethod(mark);
+        if (!this.isSatisfied()) {
+            if (this.strength === Strength.REQUIRED)
+                throw new Error("Could not satisfy a required constraint");
+            return null;
+        }
+        this.markInputs(mark);
+        const out = this.output();
+        const overridden = out.determinedBy;
+        if (overridden !== null) overridden.markUnsatisfied();
+        out.determinedBy = this;
+        if (!planner.addPropagate(this, mark)) throw new Error("Cycle encountered");
+        out.mark = mark;
+        return overridden;
+    }
+
+    destroyConstraint() {
+        if (this.isSatisfied()) planner.incrementalRemove(this);
+        else this.removeFromGraph();
+    }
+
+    isInput() {
+        return false;
+    }
+}
+
+class UnaryConstraint extends Constraint {
+    constructor(v, strength) {
+        super(strength);
+        this.myOutput = v;
+        this.satisfied = false;
+        this.addConstraint();
+    }
+
+    addToGraph() {
+        this.myOutput.addConstraint(this);
+        this.satisfied = false;
+    }
+
+    chooseMethod(mark) {
+        this.satisfied =
+            this.myOutput.mark !== mark &&
+            Strength.stronger(this.strength, this.myOutput.walkStrength);
+    }
+
+    isSatisfied() {
+        return this.satisfied;
+    }
+
+    markInputs() {}
+
+    output() {
+        return this.myOutput;
+    }
+
+    recalculate() {
+        this.myOutput.walkStrength = this.strength;
+        this.myOutput.stay = !this.isInput();
+        if (this.myOutput.stay) this.execute();
+    }
+
+    markUnsatisfied() {
+        this.satisfied = false;
+    }
+
+    inputsKnown() {
+        return true;
+    }
+
+    removeFromGraph() {
+        if (this.myOutput !== null) this.myOutput.removeConstraint(this);
+        this.satisfied = false;
+    }
+}
+
+class StayConstraint extends UnaryConstraint {
+    execute() {}
+}
+
+class EditConstraint extends UnaryConstraint {
+    isInput() {
+        return true;
+    }
+
+    execute() {}
+}
+
+const DIRECTION_NONE = 0;
+const DIRECTION_FORWARD = 1;
+const DIRECTION_BACKWARD = -1;
+
+class BinaryConstraint extends Constraint {
+    constructor(v1, v2, strength) {
+        super(strength);
+        this.v1 = v1;
+        this.v2 = v2;
+        this.direction = DIRECTION_NONE;
+    }
+
+    chooseMethod(mark) {
+        if (this.v1.mark === mark) {
+            this.direction =
+                this.v2.mark !== mark && Strength.stronger(this.strength, this.v2.walkStrength)
+                    ? DIRECTION_FORWARD
+                    : DIRECTION_NONE;
+        }
+        if (this.v2.mark === mark) {
+            this.direction =
+                this.v1.mark !== mark && Strength.stronger(this.strength, this.v1.walkStrength)
+                    ? DIRECTION_BACKWARD
+                    : DIRECTION_NONE;
+        }
+        if (Strength.weaker(this.v1.walkStrength, this.v2.walkStrength)) {
+            this.direction = Strength.stronger(this.strength, this.v1.walkStrength)
+                ? DIRECTION_BACKWARD
+                : DIRECTION_NONE;
+        } else {
+            this.direction = Strength.stronger(this.strength, this.v2.walkStrength)
+                ? DIRECTION_FORWARD
+                : DIRECTION_BACKWARD;
+        }
+    }
+
+    addToGraph() {
+        this.v1.addConstraint(this);
+        this.v2.addConstraint(this);
+        this.direction = DIRECTION_NONE;
+    }
+
+    isSatisfied() {
+        return this.direction !== DIRECTION_NONE;
+    }
+
+    markInputs(mark) {
+        this.input().mark = mark;
+    }
+
+    input() {
+        return this.direction === DIRECTION_FORWARD ? this.v1 : this.v2;
+    }
+
+    output() {
+        return this.direction === DIRECTION_FORWARD ? this.v2 : this.v1;
+    }
+
+    recalculate() {
+        const ihn = this.input();
+        const out = this.output();
+        out.walkStrength = Strength.weakest(this.strength, ihn.walkStrength);
+        out.stay = ihn.stay;
+        if (out.stay) this.execute();
+    }
+
+    markUnsatisfied() {
+        this.direction = DIRECTION_NONE;
+    }
+
+    inputsKnown(mark) {
+        const i = this.input();
+        return i.mark === mark || i.stay || i.determinedBy === null;
+    }
+
+    removeFromGraph() {
+        if (this.v1 !== null) this.v1.removeConstraint(this);
+        if (this.v2 !== null) this.v2.removeConstraint(this);
+        this.direction = DIRECTION_NONE;
+    }
+}
+
+class ScaleConstraint extends BinaryConstraint {
+    constructor(src, scale, offset, dest, strength) {
+        super(src, dest, strength);
+        this.scale = scale;
+        this.offset = offset;
+        this.addConstraint();
+    }
+
+    addToGraph() {
+        super.addToGraph();
+        this.scale.addConstraint(this);
+        this.offset.addConstraint(this);
+    }
+
+    removeFromGraph() {
+        super.removeFromGraph();
+        if (this.scale !== null) this.scale.removeConstraint(this);
+        if (this.offset !== null) this.offset.removeConstraint(this);
+    }
+
+    markInputs(mark) {
+        super.markInputs(mark);
+        this.scale.mark = this.offset.mark = mark;
+    }
+
+    execute() {
+        if (this.direction === DIRECTION_FORWARD)
+            this.v2.value = this.v1.value * this.scale.value + this.offset.value;
+        else this.v1.value = (this.v2.value - this.offset.value) / this.scale.value;
+    }
+
+    recalculate() {
+        const ihn = this.input();
+        const out = this.output();
+        out.walkStrength = Strength.weakest(this.strength, ihn.walkStrength);
+        out.stay = ihn.stay && this.scale.stay && this.offset.stay;
+        if (out.stay) this.execute();
+    }
+}
+
+class EqualityConstraint extends BinaryConstraint {
+    constructor(v1, v2, strength) {
+        super(v1, v2, strength);
+        this.addConstraint();
+    }
+
+    execute() {
+        this.output().value = this.input().value;
+    }
+}
+
+class Variable {
+    constructor(name, initialValue) {
+        this.value = initialValue ?? 0;
+        this.constraints = [];
+        this.determinedBy = null;
+        this.mark = 0;
+        this.walkStrength = Strength.WEAKEST;
+        this.stay = true;
+        this.name = name;
+    }
+
+    addConstraint(c) {
+        this.constraints.push(c);
+    }
+
+    removeConstraint(c) {
+        const index = this.constraints.indexOf(c);
+        if (index !== -1) this.constraints.splice(index, 1);
+        if (this.determinedBy === c) this.determinedBy = null;
+    }
+}
+
+class Plan {
+    constructor() {
+        this.v = [];
+    }
+
+    addConstraint(c) {
+        this.v.push(c);
+    }
+
+    size() {
+        return this.v.length;
+    }
+
+    constraintAt(index) {
+        return this.v[index];
+    }
+
+    execute() {
+        for (const c of this.v) c.execute();
+    }
+}
+
+class Planner {
+    constructor() {
+        this.currentMark = 0;
+    }
+
+    incrementalAdd(c) {
+        const mark = this.newMark();
+        let overridden = c.satisfy(mark);
+        while (overridden !== null) overridden = overridden.satisfy(mark);
+    }
+
+    incrementalRemove(c) {
+        const out = c.output();
+        c.markUnsatisfied();
+        c.removeFromGraph();
+        const unsatisfied = this.removePropagateFrom(out);
+        let strength = Strength.REQUIRED;
+        do {
+            for (const u of unsatisfied) if (u.strength === strength) this.incrementalAdd(u);
+            strength = strength.nextWeaker();
+        } while (strength !== Strength.WEAKEST);
+    }
+
+    newMark() {
+        return ++this.currentMark;
+    }
+
+    makePlan(sources) {
+        const mark = this.newMark();
+        const plan = new Plan();
+        const todo = sources;
+        while (todo.length > 0) {
+            const c = todo.pop();
+            if (c.output().mark !== mark && c.inputsKnown(mark)) {
+                plan.addConstraint(c);
+                c.output().mark = mark;
+                this.addConstraintsConsumingTo(c.output(), todo);
+            }
+        }
+        return plan;
+    }
+
+    extractPlanFromConstraints(constraints) {
+        const sources = [];
+        for (const c of constraints) if (c.isInput() && c.isSatisfied()) sources.push(c);
+        return this.makePlan(sources);
+    }
+
+    addPropagate(c, mark) {
+        const todo = [c];
+        while (todo.length > 0) {
+            const d = todo.pop();
+            if (d.output().mark === mark) {
+                this.incrementalRemove(c);
+                return false;
+            }
+            d.recalculate();
+            this.addConstraintsConsumingTo(d.output(), todo);
+        }
+        return true;
+    }
+
+    removePropagateFrom(out) {
+        out.determinedBy = null;
+        out.walkStrength = Strength.WEAKEST;
+        out.stay = true;
+        const unsatisfied = [];
+        const todo = [out];
+        while (todo.length > 0) {
+            const v = todo.pop();
+            for (const c of v.constraints) if (!c.isSatisfied()) unsatisfied.push(c);
+            const determining = v.determinedBy;
+            for (const next of v.constraints) {
+                if (next !== determining && next.isSatisfied()) {
+                    next.recalculate();
+                    todo.push(next.output());
+                }
+            }
+        }
+        return unsatisfied;
+    }
+
+    addConstraintsConsumingTo(v, coll) {
+        const determining = v.determinedBy;
+        for (const c of v.constraints) if (c !== determining && c.isSatisfied()) coll.push(c);
+    }
+}
+
+function change(v, newValue) {
+    const edit = new EditConstraint(v, Strength.PREFERRED);
+    const plan = planner.extractPlanFromConstraints([edit]);
+    for (let i = 0; i < 10; ++i) {
+        v.value = newValue;
+        plan.execute();
+    }
+    edit.destroyConstraint();
+}
+
+function chainTest(n) {
+    planner = new Planner();
+    let prev = null;
+    let first = null;
+    let last = null;
+
+    for (let i = 0; i <= n; ++i) {
+        const v = new Variable("v" + i);
+        if (prev !== null) new EqualityConstraint(prev, v, Strength.REQUIRED);
+        if (i === 0) first = v;
+        if (i === n) last = v;
+        prev = v;
+    }
+
+    new StayConstraint(last, Strength.STRONG_DEFAULT);
+    const edit = new EditConstraint(first, Strength.PREFERRED);
+    const plan = planner.extractPlanFromConstraints([edit]);
+    for (let i = 0; i < 100; ++i) {
+        first.value = i;
+        plan.execute();
+        if (last.value !== i) throw new Error("Chain test failed");
+    }
+}
+
+function projectionTest(n) {
+    planner = new Planner();
+    const scale = new Variable("scale", 10);
+    const offset = new Variable("offset", 1000);
+    let src = null;
+    let dst = null;
+
+    const dests = [];
+    for (let i = 0; i < n; ++i) {
+        src = new Variable("src" + i, i);
+        dst = new Variable("dst" + i, i);
+        dests.push(dst);
+        new StayConstraint(src, Strength.NORMAL);
+        new ScaleConstraint(src, scale, offset, dst, Strength.REQUIRED);
+    }
+
+    change(src, 17);
+    if (dst.value !== 1170) throw new Error("Projection test 1 failed");
+    change(dst, 1050);
+    if (src.value !== 5) throw new Error("Projection test 2 failed");
+    change(scale, 5);
+    for (let i = 0; i < n - 1; ++i)
+        if (dests[i].value !== i * 5 + 1000) throw new Error("Projection test 3 failed");
+    change(offset, 2000);
+    for (let i = 0; i < n - 1; ++i)
+        if (dests[i].value !== i * 5 + 2000) throw new Error("Projection test 4 failed");
+}
+
+function benchmark() {
+    chainTest(100);
+    projectionTest(100);
+}
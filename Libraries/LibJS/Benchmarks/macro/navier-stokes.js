@@ -0,0 +1,160 @@
+// A 2D fluid dynamics solver in the style of Jos Stam's "Real-Time Fluid Dynamics for Games".
+// Exercises floating point arithmetic and indexed loads and stores in tight loops over Float64Arrays.
+
+const WIDTH = 64;
+const HEIGHT = 64;
+const ITERATIONS = 10;
+const STEPS = 3;
+const EXPECTED_CHECKSUM = 1632.971452926785;
+const ROW_SIZE = WIDTH + 2;
+const SIZE = ROW_SIZE * (HEIGHT + 2);
+
+function setBoundary(b, x) {
+    const lastRow = (HEIGHT + 1) * ROW_SIZE;
+    for (let i = 1; i <= WIDTH; ++i) {
+        x[i] = b === 2 ? -x[i + ROW_SIZE] : x[i + ROW_SIZE];
+        x[i + lastRow] = b === 2 ? -x[i + lastRow - ROW_SIZE] : x[i + lastRow - ROW_SIZE];
+    }
+    for (let j = 1; j <= HEIGHT; ++j) {
+        x[j * ROW_SIZE] = b === 1 ? -x[1 + j * ROW_SIZE] : x[1 + j * ROW_SIZE];
+        x[WIDTH + 1 + j * ROW_SIZE] = b === 1 ? -x[WIDTH + j * ROW_SIZE] : x[WIDTH + j * ROW_SIZE];
+    }
+    x[0] = 0.5 * (x[1] + x[ROW_SIZE]);
+    x[lastRow] = 0.5 * (x[1 + lastRow] + x[HEIGHT * ROW_SIZE]);
+    x[WIDTH + 1] = 0.5 * (x[WIDTH] + x[WIDTH + 1 + ROW_SIZE]);
+    x[WIDTH + 1 + lastRow] = 0.5 * (x[WIDTH + lastRow] + x[WIDTH + 1 + HEIGHT * ROW_SIZE]);
+}
+
+function linearSolve(b, x, x0, a, c) {
+    const inverseC = 1 / c;
+    for (let k = 0; k < ITERATIONS; ++k) {
+        for (let j = 1; j <= HEIGHT; ++j) {
+            let current = j * ROW_SIZE;
+            for (let i = 1; i <= WIDTH; ++i) {
+                ++current;
+                const neighbours =
+                    x[current - 1] + x[current + 1] + x[current - ROW_SIZE] + x[current + ROW_SIZE];
+                x[current] = (x0[current] + a * neighbours) * inverseC;
+            }
+        }
+        setBoundary(b, x);
+    }
+}
+
+function diffuse(b, x, x0, dt) {
+    const a = 0;
+    linearSolve(b, x, x0, a, 1 + 4 * a);
+}
+
+function advect(b, d, d0, u, v, dt) {
+    const wdt0 = dt * WIDTH;
+    const hdt0 = dt * HEIGHT;
+    for (let j = 1; j <= HEIGHT; ++j) {
+        let pos = j * ROW_SIZE;
+        for (let i = 1; i <= WIDTH; ++i) {
+            ++pos;
+            let x = i - wdt0 * u[pos];
+            let y = j - hdt0 * v[pos];
+            x = Math.min(Math.max(x, 0.5), WIDTH + 0.5);
+            y = Math.min(Math.max(y, 0.5), HEIGHT + 0.5);
+            const i0 = x | 0;
+            const j0 = y | 0;
+            const s1 = x - i0;
+            const s0 = 1 - s1;
+            const t1 = y - j0;
+            const t0 = 1 - t1;
+            const row0 = j0 * ROW_SIZE;
+            const row1 = row0 + ROW_SIZE;
+            d[pos] =
+                s0 * (t0 * d0[i0 + row0] + t1 * d0[i0 + row1]) +
+                s1 * (t0 * d0[i0 + 1 + row0] + t1 * d0[i0 + 1 + row1]);
+        }
+    }
+    setBoundary(b, d);
+}
+
+function project(u, v, p, div) {
+    const h = -0.5 / Math.sqrt(WIDTH * HEIGHT);
+    for (let j = 1; j <= HEIGHT; ++j) {
+        const row = j * ROW_SIZE;
+        for (let i = 1; i <= WIDTH; ++i) {
+            div[i + row] =
+                h *
+                (u[i + 1 + row] - u[i - 1 + row] + v[i + row + ROW_SIZE] - v[i + row - ROW_SIZE]);
+            p[i + row] = 0;
+        }
+    }
+    setBoundary(0, div);
+    setBoundary(0, p);
+
+    linearSolve(0, p, div, 1, 4);
+
+    const wScale = 0.5 * WIDTH;
+    const hScale = 0.5 * HEIGHT;
+    for (let j = 1; j <= HEIGHT; ++j) {
+        const row = j * ROW_SIZE;
+        for (let i = 1; i <= WIDTH; ++i) {
+            u[i + row] -= wScale * (p[i + 1 + row] - p[i - 1 + row]);
+            v[i + row] -= hScale * (p[i + row + ROW_SIZE] - p[i + row - ROW_SIZE]);
+        }
+    }
+    setBoundary(1, u);
+    setBoundary(2, v);
+}
+
+function addSource(x, s, dt) {
+    for (let i = 0; i < SIZE; ++i) x[i] += dt * s[i];
+}
+
+function densityStep(x, x0, u, v, dt) {
+    addSource(x, x0, dt);
+    diffuse(0, x0, x, dt);
+    advect(0, x, x0, u, v, dt);
+}
+
+function velocityStep(u, v, u0, v0, dt) {
+    addSource(u, u0, dt);
+    addSource(v, v0, dt);
+    diffuse(1, u0, u, dt);
+    diffuse(2, v0, v, dt);
+    project(u0, v0, u, v);
+    advect(1, u, u0, u0, v0, dt);
+    advect(2, v, v0, u0, v0, dt);
+    project(u, v, u0, v0);
+}
+
+function simulate(steps) {
+    const dt = 0.1;
+    const density = new Float64Array(SIZE);
+    const previousDensity = new Float64Array(SIZE);
+    const u = new Float64Array(SIZE);
+    const v = new Float64Array(SIZE);
+    const previousU = new Float64Array(SIZE);
+    const previousV = new Float64Array(SIZE);
+
+    for (let step = 0; step < steps; ++step) {
+        previousDensity.fill(0);
+        previousU.fill(0);
+        previousV.fill(0);
+        for (let i = 1; i <= WIDTH; ++i) {
+            for (let j = 1; j <= HEIGHT; ++j) {
+                const index = i + j * ROW_SIZE;
+                const source = (i * j) % 5 === 0 ? 5 : 0;
+                previousU[index] = previousV[index] = previousDensity[index] = source;
+            }
+        }
+        velocityStep(u, v, previousU, previousV, dt);
+        densityStep(density, previousDensity, u, v, dt);
+    }
+
+    let checksum = 0;
+    for (let i = 0; i < SIZE; ++i) checksum += density[i];
+    return checksum;
+}
+
+function benchmark() {
+    const checksum = simulate(STEPS);
+    if (Math.abs(checksum - EXPECTED_CHECKSUM) > 1e-6)
+        throw new Error("Unexpected checksum " + checksum);
+    return checksum;
+}
@@ -0,0 +1,21 @@
+// Async functions awaiting values, other async functions and async generators.
+
+async function increment(value) {
+    return value + 1;
+}
+
+async function* range(count) {
+    for (let i = 0; i < count; ++i) yield i;
+}
+
+async function benchmark() {
+    let value = 0;
+    for (let i = 0; i < 10_000; ++i) value = await increment(value);
+    for (let i = 0; i < 10_000; ++i) value += await i;
+
+    let sum = 0;
+    for await (const i of range(5_000)) sum += i;
+
+    if (value !== 10_000 + 49_995_000 || sum !== 12_497_500)
+        throw new Error("Async functions produced the wrong result");
+}
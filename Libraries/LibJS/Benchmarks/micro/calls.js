@@ -0,0 +1,44 @@
+// Direct, method and recursive calls, plus calls with a varying number of arguments.
+
+function add(a, b) {
+    return a + b;
+}
+
+function fib(n) {
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+function sumArguments() {
+    let sum = 0;
+    for (let i = 0; i < arguments.length; ++i) sum += arguments[i];
+    return sum;
+}
+
+function sumRest(...values) {
+    let sum = 0;
+    for (const value of values) sum += value;
+    return sum;
+}
+
+const calculator = {
+    total: 0,
+    add(value) {
+        this.total += value;
+        return this;
+    },
+};
+
+function benchmark() {
+    let sum = 0;
+    for (let i = 0; i < 50_000; ++i) sum = add(sum, i);
+
+    if (fib(20) !== 6765) throw new Error("fib(20) returned the wrong value");
+
+    for (let i = 0; i < 10_000; ++i) sum += sumArguments(i, 1, 2) + sumRest(i, 1, 2);
+
+    calculator.total = 0;
+    for (let i = 0; i < 50_000; ++i) calculator.add(1);
+    if (calculator.total !== 50_000) throw new Error("Method calls produced the wrong total");
+
+    return sum;
+}
@@ -0,0 +1,37 @@
+// Closure creation, captured variable access and higher-order array builtins.
+
+function makeCounter() {
+    let count = 0;
+    return () => ++count;
+}
+
+function makeAdder(amount) {
+    return value => value + amount;
+}
+
+const numbers = Array.from({ length: 10_000 }, (_, i) => i);
+
+function benchmark() {
+    let total = 0;
+
+    for (let i = 0; i < 20_000; ++i) {
+        const counter = makeCounter();
+        counter();
+        total += counter();
+    }
+
+    const counter = makeCounter();
+    for (let i = 0; i < 200_000; ++i) counter();
+    total += counter();
+
+    const addFive = makeAdder(5);
+    for (let i = 0; i < 5; ++i) {
+        total += numbers
+            .map(addFive)
+            .filter(value => value % 3 === 0)
+            .reduce((sum, value) => sum + value, 0);
+    }
+
+    if (total <= 0) throw new Error("Unexpected total " + total);
+    return total;
+}
@@ -0,0 +1,24 @@
+// JSON.parse and JSON.stringify on a document with nested objects, arrays, strings and numbers.
+
+const document = {
+    version: 3,
+    items: Array.from({ length: 2_000 }, (_, i) => ({
+        id: i,
+        name: `Item number ${i}`,
+        price: i * 1.25,
+        tags: ["a", "b", i % 2 ? "odd" : "even"],
+        dimensions: { width: i % 10, height: i % 7, depth: null },
+        available: i % 3 !== 0,
+    })),
+};
+
+function benchmark() {
+    const text = JSON.stringify(document);
+    const parsed = JSON.parse(text);
+    const pretty = JSON.stringify(parsed, null, 2);
+
+    if (parsed.items.length !== 2_000 || parsed.items[1999].tags[2] !== "odd")
+        throw new Error("JSON round trip produced the wrong result");
+
+    return text.length + pretty.length;
+}
@@ -0,0 +1,27 @@
+// Map and Set insertion, lookup, deletion and iteration with number, string and object keys.
+
+const objectKeys = Array.from({ length: 2_000 }, (_, i) => ({ i }));
+const stringKeys = Array.from({ length: 2_000 }, (_, i) => "key" + i);
+
+function benchmark() {
+    const map = new Map();
+    for (let i = 0; i < 10_000; ++i) map.set(i, i * 2);
+    for (const key of stringKeys) map.set(key, key.length);
+    for (const key of objectKeys) map.set(key, key.i);
+
+    let sum = 0;
+    for (let i = 0; i < 10_000; ++i) sum += map.get(i);
+    for (const key of objectKeys) sum += map.get(key);
+
+    for (let i = 0; i < 10_000; i += 2) map.delete(i);
+    for (const [key, value] of map) if (typeof key === "number") sum += value;
+
+    const set = new Set();
+    for (let i = 0; i < 10_000; ++i) set.add(i % 4_000);
+    for (const key of stringKeys) set.add(key);
+    let present = 0;
+    for (let i = 0; i < 8_000; ++i) if (set.has(i)) ++present;
+
+    if (set.size !== 6_000 || present !== 4_000) throw new Error("Set produced the wrong result");
+    return sum;
+}
@@ -0,0 +1,14 @@
+// Promise creation, chaining and combinators, driven entirely by the promise job queue.
+
+function benchmark() {
+    let chain = Promise.resolve(0);
+    for (let i = 0; i < 20_000; ++i) chain = chain.then(value => value + 1);
+
+    const all = Promise.all(Array.from({ length: 5_000 }, (_, i) => Promise.resolve(i)));
+    const settled = Promise.allSettled([Promise.reject(new Error("expected")), Promise.resolve(1)]);
+
+    return Promise.all([chain, all, settled]).then(([count, values, results]) => {
+        if (count !== 20_000 || values.length !== 5_000 || results[0].status !== "rejected")
+            throw new Error("Promises produced the wrong result");
+    });
+}
@@ -0,0 +1,39 @@
+// Monomorphic and polymorphic named property loads and stores, plus prototype chain lookups.
+
+class Point {
+    constructor(x, y) {
+        this.x = x;
+        this.y = y;
+    }
+
+    get length() {
+        return Math.sqrt(this.x * this.x + this.y * this.y);
+    }
+}
+
+const shapes = [
+    { x: 1, y: 2 },
+    { y: 2, x: 1 },
+    { x: 1, y: 2, z: 3 },
+    { w: 0, x: 1, y: 2 },
+];
+
+function benchmark() {
+    let sum = 0;
+
+    const point = new Point(3, 4);
+    for (let i = 0; i < 50_000; ++i) {
+        point.x = i & 7;
+        sum += point.x + point.y;
+    }
+
+    for (let i = 0; i < 50_000; ++i) {
+        const object = shapes[i & 3];
+        sum += object.x + object.y;
+    }
+
+    for (let i = 0; i < 25_000; ++i) sum += point.length;
+
+    if (sum <= 0) throw new Error("Unexpected sum " + sum);
+    return sum;
+}
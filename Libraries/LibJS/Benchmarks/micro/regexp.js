@@ -0,0 +1,28 @@
+// Regular expression matching, capturing, global replacement and splitting.
+
+const lines = [];
+for (let i = 0; i < 2_000; ++i) {
+    const date = `2024-${(i % 12) + 1}-${(i % 28) + 1}`;
+    lines.push(`${date} user${i}@example.com GET /path/${i}?q=${i * 7}`);
+}
+const log = lines.join("\n");
+
+const dateRegex = /(\d{4})-(\d{1,2})-(\d{1,2})/;
+const emailRegex = /[a-z0-9]+@[a-z]+\.[a-z]+/g;
+
+function benchmark() {
+    let months = 0;
+    for (const line of lines) {
+        const match = dateRegex.exec(line);
+        months += Number(match[2]);
+    }
+
+    const emails = log.match(emailRegex);
+    const redacted = log.replace(/\d+/g, "#");
+    const fields = log.split(/\s+/);
+
+    if (emails.length !== 2_000 || fields.length !== 8_000 || redacted.includes("2024"))
+        throw new Error("Regular expressions produced the wrong result");
+
+    return months;
+}
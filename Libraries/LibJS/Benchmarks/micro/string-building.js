@@ -0,0 +1,22 @@
+// String concatenation in loops, template literals, joins and common string builtins.
+
+function benchmark() {
+    let concatenated = "";
+    for (let i = 0; i < 20_000; ++i) concatenated += "x" + i;
+
+    const parts = [];
+    for (let i = 0; i < 20_000; ++i) parts.push(`item-${i}`);
+    const joined = parts.join(",");
+
+    let characters = 0;
+    for (let i = 0; i < joined.length; i += 97) characters += joined.charCodeAt(i);
+
+    const words = joined.split(",");
+    const upper = words.slice(0, 5_000).map(word => word.toUpperCase());
+    const found = joined.indexOf("item-19999");
+
+    if (words.length !== 20_000 || found < 0 || upper[42] !== "ITEM-42")
+        throw new Error("String operations produced the wrong result");
+
+    return concatenated.length + characters;
+}
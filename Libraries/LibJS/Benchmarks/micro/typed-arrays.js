@@ -0,0 +1,27 @@
+// Element loads and stores on typed arrays, plus builtins that operate on them.
+
+const length = 100_000;
+const floats = new Float64Array(length);
+const ints = new Int32Array(length);
+const bytes = new Uint8Array(length);
+
+function benchmark() {
+    for (let i = 0; i < length; ++i) {
+        floats[i] = i * 0.5;
+        ints[i] = i ^ 0x5a5a;
+        bytes[i] = i;
+    }
+
+    let sum = 0;
+    for (let i = 0; i < length; ++i) sum += floats[i] + ints[i] + bytes[i];
+
+    const view = new DataView(bytes.buffer);
+    for (let i = 0; i + 4 <= length; i += 4) sum += view.getUint32(i, true) & 0xff;
+
+    const copy = ints.slice();
+    copy.sort();
+    sum += copy[0] + floats.subarray(10, 20).reduce((a, b) => a + b, 0);
+
+    if (!Number.isFinite(sum)) throw new Error("Unexpected sum " + sum);
+    return sum;
+}
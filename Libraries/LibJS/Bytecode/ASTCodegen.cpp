@@ -1816,6 +1816,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
                 callee,
                 this_value,
                 argument_operands,
+                generator.next_call_site_cache(),
                 expression_string_index);
         }
     }
@@ -2919,6 +2920,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ClassExpression::genera
 
     auto dst = choose_dst(generator, preferred_dst);
     generator.emit_with_extra_slots<Op::NewClass, Optional<Operand>>(elements.size(), dst, super_class.has_value() ? super_class->operand() : Optional<Operand> {}, *this, lhs_name, elements);
+    generator.retain_ast_node(*this);
 
     generator.emit<Op::LeavePrivateEnvironment>();
 
@@ -11,6 +11,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/OwnPtr.h>
 #include <AK/WeakPtr.h>
+#include <AK/Weakable.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Bytecode/IdentifierTable.h>
 #include <LibJS/Bytecode/Label.h>
@@ -43,12 +44,37 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// Remembers the function most recently called from one call site, along with the frame layout of its
+// executable, so that repeated calls to the same function can skip asking the callee for its frame size.
+// The state and call count double as call site feedback for a future optimizing tier.
+struct CallSiteCache {
+    static constexpr u32 max_number_of_callee_changes = 4;
+
+    enum class State : u8 {
+        Uninitialized,
+        Monomorphic,
+        Polymorphic,
+        Megamorphic,
+    };
+
+    WeakPtr<ECMAScriptFunctionObject> callee;
+    // NOTE: This is kept alive by the callee, and must not be dereferenced once the callee is gone.
+    Executable const* executable { nullptr };
+    size_t registers_and_constants_and_locals_count { 0 };
+    size_t formal_parameter_count { 0 };
+    u64 call_count { 0 };
+    u32 number_of_callee_changes { 0 };
+    State state { State::Uninitialized };
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
 };
 
-class JS_API Executable final : public Cell {
+class JS_API Executable final
+    : public Cell
+    , public Weakable<Executable> {
     GC_CELL(Executable, Cell);
     GC_DECLARE_ALLOCATOR(Executable);
 
@@ -62,6 +88,7 @@ public:
         NonnullRefPtr<SourceCode const>,
         size_t number_of_property_lookup_caches,
         size_t number_of_global_variable_caches,
+        size_t number_of_call_site_caches,
         size_t number_of_registers,
         bool is_strict_mode);
 
@@ -71,6 +98,7 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<CallSiteCache> call_site_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
@@ -98,6 +126,9 @@ public:
 
     Optional<IdentifierTableIndex> length_identifier;
 
+    // AST nodes referenced by instructions (functions, classes and blocks), which must outlive the code they came from.
+    Vector<NonnullRefPtr<ASTNode const>> retained_ast_nodes;
+
     String const& get_string(StringTableIndex index) const { return string_table->get(index); }
     FlyString const& get_identifier(IdentifierTableIndex index) const { return identifier_table->get(index); }
 
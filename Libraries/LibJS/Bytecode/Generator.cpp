@@ -204,10 +204,12 @@ CodeGenerationErrorOr<void> Generator::emit_function_declaration_instantiation(E
         if (identifier.is_local()) {
             auto local_index = identifier.local_index();
             emit<Op::NewFunction>(local(local_index), declaration, OptionalNone {});
+            retain_ast_node(declaration);
             set_local_initialized(local_index);
         } else {
             auto function = allocate_register();
             emit<Op::NewFunction>(function, declaration, OptionalNone {});
+            retain_ast_node(declaration);
             emit<Op::SetVariableBinding>(intern_identifier(declaration.name()), function);
         }
     }
@@ -452,6 +454,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         node.source_code(),
         generator.m_next_property_lookup_cache,
         generator.m_next_global_variable_cache,
+        generator.m_next_call_site_cache,
         generator.m_next_register,
         is_strict_mode);
 
@@ -476,6 +479,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     executable->local_index_base = number_of_registers + number_of_constants;
     executable->argument_index_base = number_of_registers + number_of_constants + number_of_locals;
     executable->length_identifier = generator.m_length_identifier;
+    executable->retained_ast_nodes = move(generator.m_retained_ast_nodes);
 
     generator.m_finished = true;
 
@@ -574,6 +578,7 @@ bool Generator::emit_block_declaration_instantiation(ScopeNode const& scope_node
     //        and get rid of the BlockDeclarationInstantiation instruction.
     start_boundary(BlockBoundaryType::LeaveLexicalEnvironment);
     emit<Bytecode::Op::BlockDeclarationInstantiation>(scope_node);
+    retain_ast_node(scope_node);
     return true;
 }
 
@@ -1088,6 +1093,7 @@ void Generator::emit_new_function(ScopedOperand dst, FunctionExpression const& f
     } else {
         emit<Op::NewFunction>(dst, function_node, lhs_name, m_home_objects.last());
     }
+    retain_ast_node(function_node);
 }
 
 CodeGenerationErrorOr<ScopedOperand> Generator::emit_named_evaluation_if_anonymous_function(Expression const& expression, Optional<IdentifierTableIndex> lhs_name, Optional<ScopedOperand> preferred_dst)
@@ -165,6 +165,10 @@ public:
     void pop_home_object();
     void emit_new_function(ScopedOperand dst, JS::FunctionExpression const&, Optional<IdentifierTableIndex> lhs_name);
 
+    // Instructions that refer to AST nodes must keep them alive, since the statements they came from are released
+    // once code generation is done.
+    void retain_ast_node(ASTNode const& node) { m_retained_ast_nodes.append(node); }
+
     CodeGenerationErrorOr<ScopedOperand> emit_named_evaluation_if_anonymous_function(Expression const&, Optional<IdentifierTableIndex> lhs_name, Optional<ScopedOperand> preferred_dst = {});
 
     void begin_continuable_scope(Label continue_target, Vector<FlyString> const& language_label_set);
@@ -337,6 +341,7 @@ public:
 
     [[nodiscard]] size_t next_global_variable_cache() { return m_next_global_variable_cache++; }
     [[nodiscard]] size_t next_property_lookup_cache() { return m_next_property_lookup_cache++; }
+    [[nodiscard]] size_t next_call_site_cache() { return m_next_call_site_cache++; }
 
     enum class DeduplicateConstant {
         Yes,
@@ -407,6 +412,7 @@ private:
     u32 m_next_block { 1 };
     u32 m_next_property_lookup_cache { 0 };
     u32 m_next_global_variable_cache { 0 };
+    u32 m_next_call_site_cache { 0 };
     FunctionKind m_enclosing_function_kind { FunctionKind::Normal };
     Vector<LabelableScope> m_continuable_scopes;
     Vector<LabelableScope> m_breakable_scopes;
@@ -423,6 +429,8 @@ private:
     GC::Ptr<ECMAScriptFunctionObject const> m_function;
 
     Optional<IdentifierTableIndex> m_length_identifier;
+
+    Vector<NonnullRefPtr<ASTNode const>> m_retained_ast_nodes;
 };
 
 }
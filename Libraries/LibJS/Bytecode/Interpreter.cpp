@@ -8,6 +8,7 @@
 #include <AK/Debug.h>
 #include <AK/HashTable.h>
 #include <AK/TemporaryChange.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/RootHashMap.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/BasicBlock.h>
@@ -16,6 +17,7 @@
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Profiler.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
@@ -190,6 +192,14 @@ Interpreter::~Interpreter()
 {
 }
 
+void Interpreter::set_profiling_enabled(bool enabled)
+{
+    if (enabled)
+        m_profiler = make<Profiler>(m_vm.heap());
+    else
+        m_profiler = nullptr;
+}
+
 ALWAYS_INLINE Value Interpreter::get(Operand op) const
 {
     return m_registers_and_constants_and_locals_arguments.data()[op.index()];
@@ -211,6 +221,8 @@ ALWAYS_INLINE Value Interpreter::do_yield(Value value, Optional<Label> continuat
 // 16.1.6 ScriptEvaluation ( scriptRecord ), https://tc39.es/ecma262/#sec-runtime-semantics-scriptevaluation
 ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environment> lexical_environment_override)
 {
+    Core::ScopedTraceEvent trace_event { "js"sv, "ScriptEvaluation"sv };
+
     auto& vm = this->vm();
 
     // 1. Let globalEnv be scriptRecord.[[Realm]].[[GlobalEnv]].
@@ -226,7 +238,10 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environ
     Completion result = instantiation_result.is_throw_completion() ? instantiation_result.throw_completion() : normal_completion(js_undefined());
 
     GC::Ptr<Executable> executable;
-    if (result.type() == Completion::Type::Normal) {
+    if (result.type() == Completion::Type::Normal && script.bytecode_executable()) {
+        // OPTIMIZATION: This program was cached and has been evaluated before, so we can reuse its bytecode.
+        executable = script.bytecode_executable();
+    } else if (result.type() == Completion::Type::Normal) {
         auto executable_result = JS::Bytecode::Generator::generate_from_ast_node(vm, script, {});
 
         if (executable_result.is_error()) {
@@ -238,6 +253,10 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environ
                 result = vm.template throw_completion<JS::InternalError>(error_string.release_value());
         } else {
             executable = executable_result.release_value();
+            script.set_bytecode_executable(executable);
+
+            // NOTE: The top-level statements are only needed to generate bytecode, which is now cached on the program.
+            script.release_children();
 
             if (g_dump_bytecode)
                 executable->dump();
@@ -390,6 +409,16 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     };
 #undef SET_UP_LABEL
 
+    // When profiling, every instruction is first routed through a `profile_*` label that counts it,
+    // so the regular dispatch path does not pay for profiling when it's disabled.
+    static void* const profiling_dispatch_table[] = {
+#define SET_UP_PROFILING_LABEL(name) &&profile_##name,
+        ENUMERATE_BYTECODE_OPS(SET_UP_PROFILING_LABEL)
+    };
+#undef SET_UP_PROFILING_LABEL
+
+    void* const* dispatch_table = m_profiler ? profiling_dispatch_table : bytecode_dispatch_table;
+
 #define DISPATCH_NEXT(name)                                                                         \
     do {                                                                                            \
         if constexpr (Op::name::IsVariableLength)                                                   \
@@ -397,13 +426,22 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         else                                                                                        \
             program_counter += sizeof(Op::name);                                                    \
         auto& next_instruction = *reinterpret_cast<Instruction const*>(&bytecode[program_counter]); \
-        goto* bytecode_dispatch_table[static_cast<size_t>(next_instruction.type())];                \
+        goto* dispatch_table[static_cast<size_t>(next_instruction.type())];                         \
     } while (0)
 
     for (;;) {
     start:
         for (;;) {
-            goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
+            goto* dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
+
+            // NOTE: The dispatch table is chosen on entry, so profiling may have been disabled since.
+#define DEFINE_PROFILING_LABEL(name)                        \
+    profile_##name:                                         \
+        if (auto* profiler = m_profiler.ptr()) [[likely]]   \
+            profiler->did_execute(Instruction::Type::name); \
+        goto handle_##name;
+            ENUMERATE_BYTECODE_OPS(DEFINE_PROFILING_LABEL)
+#undef DEFINE_PROFILING_LABEL
 
         handle_Mov: {
             auto& instruction = *reinterpret_cast<Op::Mov const*>(&bytecode[program_counter]);
@@ -750,8 +788,14 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
         registers_and_constants_and_locals_and_arguments[executable.number_of_registers + i] = executable.constants[i];
     }
 
+    if (m_profiler) [[unlikely]]
+        m_profiler->will_run_executable(executable);
+
     run_bytecode(entry_point.value_or(0));
 
+    if (m_profiler) [[unlikely]]
+        m_profiler->did_run_executable();
+
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter did run unit {:p}", &executable);
 
     if constexpr (JS_BYTECODE_DEBUG) {
@@ -1006,12 +1050,16 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
                 return true;
             }();
             if (can_use_cache) {
+                if (auto* profiler = vm.bytecode_interpreter().profiler()) [[unlikely]]
+                    profiler->did_hit_property_lookup_cache(cache);
                 auto value = cache_entry.prototype->get_direct(cache_entry.property_offset.value());
                 if (value.is_accessor())
                     return TRY(call(vm, value.as_accessor().getter(), this_value));
                 return value;
             }
         } else if (&shape == cache_entry.shape) {
+            if (auto* profiler = vm.bytecode_interpreter().profiler()) [[unlikely]]
+                profiler->did_hit_property_lookup_cache(cache);
             // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
             auto value = base_obj->get_direct(cache_entry.property_offset.value());
             if (value.is_accessor())
@@ -1020,6 +1068,9 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
         }
     }
 
+    if (auto* profiler = vm.bytecode_interpreter().profiler()) [[unlikely]]
+        profiler->did_miss_property_lookup_cache(cache);
+
     CacheablePropertyMetadata cacheable_metadata;
     auto value = TRY(base_obj->internal_get(executable.get_identifier(property), this_value, &cacheable_metadata));
 
@@ -1062,6 +1113,11 @@ inline ThrowCompletionOr<Value> get_by_value(VM& vm, Optional<IdentifierTableInd
         // For "non-typed arrays":
         if (!object.may_interfere_with_indexed_property_access()
             && object_storage) {
+            if (object_storage->is_simple_storage()) {
+                auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*object_storage);
+                if (simple_storage.has_packed_number_elements() && index < simple_storage.array_like_size())
+                    return simple_storage.elements().data()[index];
+            }
             auto maybe_value = [&] {
                 if (object_storage->is_simple_storage())
                     return static_cast<SimpleIndexedPropertyStorage const*>(object_storage)->inline_get(index);
@@ -1250,11 +1306,15 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                     if (can_use_cache) {
                         auto value_in_prototype = cache.prototype->get_direct(cache.property_offset.value());
                         if (value_in_prototype.is_accessor()) {
+                            if (auto* profiler = vm.bytecode_interpreter().profiler()) [[unlikely]]
+                                profiler->did_hit_property_lookup_cache(*caches);
                             TRY(call(vm, value_in_prototype.as_accessor().setter(), this_value, value));
                             return {};
                         }
                     }
                 } else if (cache.shape == &object->shape()) {
+                    if (auto* profiler = vm.bytecode_interpreter().profiler()) [[unlikely]]
+                        profiler->did_hit_property_lookup_cache(*caches);
                     auto value_in_object = object->get_direct(cache.property_offset.value());
                     if (value_in_object.is_accessor()) {
                         TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
@@ -1264,6 +1324,9 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                     return {};
                 }
             }
+
+            if (auto* profiler = vm.bytecode_interpreter().profiler()) [[unlikely]]
+                profiler->did_miss_property_lookup_cache(*caches);
         }
 
         CacheablePropertyMetadata cacheable_metadata;
@@ -1388,7 +1451,10 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<FlyStri
         if (storage
             && storage->is_simple_storage()
             && !object.may_interfere_with_indexed_property_access()) {
-            auto maybe_value = storage->get(index);
+            auto& simple_storage = static_cast<SimpleIndexedPropertyStorage&>(*storage);
+            if (simple_storage.try_fast_put(index, value))
+                return {};
+            auto maybe_value = simple_storage.inline_get(index);
             if (maybe_value.has_value()) {
                 auto existing_value = maybe_value->value;
                 if (!existing_value.is_accessor()) {
@@ -2837,6 +2903,33 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
     VERIFY_NOT_REACHED();
 }
 
+static void update_call_site_cache(CallSiteCache& cache, ECMAScriptFunctionObject& callee, size_t registers_and_constants_and_locals_count)
+{
+    if (cache.state == CallSiteCache::State::Megamorphic)
+        return;
+
+    auto const* executable = callee.bytecode_executable().ptr();
+
+    // NOTE: Closures created from the same function node share their executable, so switching between
+    //       them doesn't make the call site any less monomorphic from the point of view of the code it runs.
+    if (cache.state == CallSiteCache::State::Uninitialized) {
+        cache.state = CallSiteCache::State::Monomorphic;
+    } else if (cache.executable != executable) {
+        if (++cache.number_of_callee_changes >= CallSiteCache::max_number_of_callee_changes) {
+            cache.state = CallSiteCache::State::Megamorphic;
+            cache.callee = nullptr;
+            cache.executable = nullptr;
+            return;
+        }
+        cache.state = CallSiteCache::State::Polymorphic;
+    }
+
+    cache.callee = callee;
+    cache.executable = executable;
+    cache.registers_and_constants_and_locals_count = registers_and_constants_and_locals_count;
+    cache.formal_parameter_count = callee.formal_parameters().size();
+}
+
 ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto callee = interpreter.get(m_callee);
@@ -2847,10 +2940,23 @@ ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) c
 
     auto& function = callee.as_function();
 
+    auto& cache = interpreter.current_executable().call_site_caches[m_cache_index];
+    ++cache.call_count;
+
     ExecutionContext* callee_context = nullptr;
     size_t registers_and_constants_and_locals_count = 0;
     size_t argument_count = m_argument_count;
-    TRY(function.get_stack_frame_size(registers_and_constants_and_locals_count, argument_count));
+
+    // OPTIMIZATION: If this call site has called this function before, we already know the size of its frame.
+    if (cache.callee.ptr() == &function) [[likely]] {
+        registers_and_constants_and_locals_count = cache.registers_and_constants_and_locals_count;
+        argument_count = max(argument_count, cache.formal_parameter_count);
+    } else {
+        TRY(function.get_stack_frame_size(registers_and_constants_and_locals_count, argument_count));
+        if (function.is_ecmascript_function_object())
+            update_call_site_cache(cache, static_cast<ECMAScriptFunctionObject&>(function), registers_and_constants_and_locals_count);
+    }
+
     ALLOCATE_EXECUTION_CONTEXT_ON_NATIVE_STACK_WITHOUT_CLEARING_ARGS(callee_context, registers_and_constants_and_locals_count, max(m_argument_count, argument_count));
 
     auto* callee_context_argument_values = callee_context->arguments.data();
@@ -19,6 +19,7 @@
 namespace JS::Bytecode {
 
 class InstructionStreamIterator;
+class Profiler;
 
 class JS_API Interpreter {
 public:
@@ -85,6 +86,10 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    // Profiling is off by default. Enabling it starts a fresh profile, disabling it discards the current one.
+    Profiler* profiler() { return m_profiler.ptr(); }
+    void set_profiling_enabled(bool);
+
 private:
     void run_bytecode(size_t entry_point);
 
@@ -103,6 +108,7 @@ private:
     Span<Value> m_registers_and_constants_and_locals_arguments;
     Vector<Value> m_argument_values_buffer;
     ExecutionContext* m_running_execution_context { nullptr };
+    OwnPtr<Profiler> m_profiler;
 };
 
 JS_API extern bool g_dump_bytecode;
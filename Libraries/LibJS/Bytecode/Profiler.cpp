@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibGC/Heap.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Profiler.h>
+#include <LibJS/SourceCode.h>
+
+namespace JS::Bytecode {
+
+static constexpr size_t max_number_of_executables_in_report = 50;
+static constexpr size_t max_number_of_property_lookup_caches_in_report = 50;
+
+static constexpr AK::Array<StringView, number_of_instruction_types> instruction_type_names = {
+#define __BYTECODE_OP(op) #op##sv,
+    ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+};
+
+static String describe_executable(Executable const& executable)
+{
+    auto name = executable.name.is_empty() ? "(anonymous)"sv : executable.name.bytes_as_string_view();
+
+    Optional<u32> start_offset;
+    for (auto const& it : executable.source_map) {
+        if (!start_offset.has_value() || it.value.source_start_offset < *start_offset)
+            start_offset = it.value.source_start_offset;
+    }
+    if (!start_offset.has_value())
+        return MUST(String::formatted("{} ({})", name, executable.source_code->filename()));
+
+    auto range = executable.source_code->range_from_offsets(*start_offset, *start_offset);
+    return MUST(String::formatted("{} ({}:{}:{})", name, executable.source_code->filename(), range.start.line, range.start.column));
+}
+
+Profiler::Profiler(GC::Heap& heap)
+    : m_heap(heap)
+{
+}
+
+Profiler::~Profiler() = default;
+
+Profiler::ExecutableProfile& Profiler::profile_for(Executable const& executable)
+{
+    if (auto it = m_executable_profiles.find(&executable); it != m_executable_profiles.end()) {
+        if (it->value->executable.ptr() == &executable)
+            return *it->value;
+
+        // The executable this profile belonged to has been collected, and a new one was allocated in its place.
+        m_retired_executable_profiles.append(move(it->value));
+        m_executable_profiles.remove(it);
+    }
+
+    auto profile = make<ExecutableProfile>();
+    profile->executable = const_cast<Executable&>(executable).make_weak_ptr<Executable>();
+    profile->name = describe_executable(executable);
+    profile->property_lookup_caches.resize(executable.property_lookup_caches.size());
+
+    auto& result = *profile;
+    m_executable_profiles.set(&executable, move(profile));
+    return result;
+}
+
+void Profiler::will_run_executable(Executable const& executable)
+{
+    auto& profile = profile_for(executable);
+    ++profile.runs;
+
+    m_frames.append({
+        .executable = &executable,
+        .profile = &profile,
+        .start = MonotonicTime::now(),
+        .allocated_cells_at_start = m_heap.statistics().allocated_cells,
+    });
+}
+
+void Profiler::did_run_executable()
+{
+    // NOTE: Profiling may have been enabled while this executable was already running.
+    if (m_frames.is_empty())
+        return;
+
+    auto frame = m_frames.take_last();
+    auto total_time = MonotonicTime::now() - frame.start;
+    auto total_allocated_cells = m_heap.statistics().allocated_cells - frame.allocated_cells_at_start;
+
+    frame.profile->self_time += total_time - frame.time_in_callees;
+    frame.profile->self_allocated_cells += total_allocated_cells - frame.allocated_cells_in_callees;
+
+    if (!m_frames.is_empty()) {
+        m_frames.last().time_in_callees += total_time;
+        m_frames.last().allocated_cells_in_callees += total_allocated_cells;
+    }
+}
+
+void Profiler::record_property_lookup_cache_access(PropertyLookupCache const& cache, bool hit)
+{
+    if (m_frames.is_empty())
+        return;
+
+    // NOTE: Property lookups always use a cache belonging to the executable that is currently running.
+    auto const& frame = m_frames.last();
+    auto const& caches = frame.executable->property_lookup_caches;
+    if (&cache < caches.data() || &cache >= caches.data() + caches.size())
+        return;
+
+    auto& cache_profile = frame.profile->property_lookup_caches[&cache - caches.data()];
+    if (hit)
+        ++cache_profile.hits;
+    else
+        ++cache_profile.misses;
+}
+
+String Profiler::report() const
+{
+    StringBuilder builder;
+    builder.append("Bytecode profile\n"sv);
+    builder.append("=============================================\n"sv);
+
+    u64 total_instructions = 0;
+    Vector<size_t> instruction_types;
+    for (size_t i = 0; i < number_of_instruction_types; ++i) {
+        total_instructions += m_instruction_counts[i];
+        if (m_instruction_counts[i] != 0)
+            instruction_types.append(i);
+    }
+    quick_sort(instruction_types, [&](auto a, auto b) { return m_instruction_counts[a] > m_instruction_counts[b]; });
+
+    builder.appendff("Instructions executed: {}\n", total_instructions);
+    for (auto type : instruction_types) {
+        auto count = m_instruction_counts[type];
+        builder.appendff("{:>14} {:>6.2}%  {}\n", count, static_cast<double>(count) * 100.0 / static_cast<double>(total_instructions), instruction_type_names[type]);
+    }
+
+    Vector<ExecutableProfile const*> executables;
+    for (auto const& it : m_executable_profiles)
+        executables.append(it.value.ptr());
+    for (auto const& profile : m_retired_executable_profiles)
+        executables.append(profile.ptr());
+    quick_sort(executables, [](auto const* a, auto const* b) { return a->self_time > b->self_time; });
+
+    builder.append("\nExecutables by self time:\n"sv);
+    builder.appendff("{:>12} {:>10} {:>12}  {}\n", "self ms"sv, "runs"sv, "allocations"sv, "executable"sv);
+    for (size_t i = 0; i < min(executables.size(), max_number_of_executables_in_report); ++i) {
+        auto const& profile = *executables[i];
+        auto self_ms = static_cast<double>(profile.self_time.to_microseconds()) / 1000.0;
+        builder.appendff("{:>12.3} {:>10} {:>12}  {}\n", self_ms, profile.runs, profile.self_allocated_cells, profile.name);
+    }
+
+    struct CacheEntry {
+        ExecutableProfile const* executable;
+        size_t index;
+        PropertyLookupCacheProfile counts;
+    };
+    Vector<CacheEntry> caches;
+    u64 total_hits = 0;
+    u64 total_misses = 0;
+    for (auto const* profile : executables) {
+        for (size_t i = 0; i < profile->property_lookup_caches.size(); ++i) {
+            auto const& counts = profile->property_lookup_caches[i];
+            total_hits += counts.hits;
+            total_misses += counts.misses;
+            if (counts.misses != 0)
+                caches.append({ profile, i, counts });
+        }
+    }
+    quick_sort(caches, [](auto const& a, auto const& b) { return a.counts.misses > b.counts.misses; });
+
+    auto hit_rate = [](u64 hits, u64 misses) {
+        if (hits + misses == 0)
+            return 0.0;
+        return static_cast<double>(hits) * 100.0 / static_cast<double>(hits + misses);
+    };
+
+    builder.appendff("\nProperty lookup caches: {} hits, {} misses ({:.2}% hit rate)\n", total_hits, total_misses, hit_rate(total_hits, total_misses));
+    builder.appendff("{:>12} {:>12} {:>8}  {}\n", "hits"sv, "misses"sv, "hit %"sv, "cache"sv);
+    for (size_t i = 0; i < min(caches.size(), max_number_of_property_lookup_caches_in_report); ++i) {
+        auto const& cache = caches[i];
+        builder.appendff("{:>12} {:>12} {:>7.2}%  #{} in {}\n", cache.counts.hits, cache.counts.misses, hit_rate(cache.counts.hits, cache.counts.misses), cache.index, cache.executable->name);
+    }
+
+    builder.append("=============================================\n"sv);
+    return MUST(builder.to_string());
+}
+
+}
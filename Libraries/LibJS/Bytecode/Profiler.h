@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <AK/WeakPtr.h>
+#include <LibGC/Forward.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+
+namespace JS::Bytecode {
+
+static constexpr size_t number_of_instruction_types = 0
+#define __BYTECODE_OP(op) +1
+    ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    ;
+
+// Collects execution statistics for the bytecode interpreter while profiling is enabled:
+// how often each opcode runs, how much time and how many allocations each executable accounts for
+// (excluding the executables it calls into), and how well each property lookup cache performs.
+class JS_API Profiler {
+    AK_MAKE_NONCOPYABLE(Profiler);
+    AK_MAKE_NONMOVABLE(Profiler);
+
+public:
+    explicit Profiler(GC::Heap&);
+    ~Profiler();
+
+    ALWAYS_INLINE void did_execute(Instruction::Type type) { ++m_instruction_counts[to_underlying(type)]; }
+    u64 instruction_count(Instruction::Type type) const { return m_instruction_counts[to_underlying(type)]; }
+
+    void will_run_executable(Executable const&);
+    void did_run_executable();
+
+    void did_hit_property_lookup_cache(PropertyLookupCache const& cache) { record_property_lookup_cache_access(cache, true); }
+    void did_miss_property_lookup_cache(PropertyLookupCache const& cache) { record_property_lookup_cache_access(cache, false); }
+
+    String report() const;
+
+private:
+    struct PropertyLookupCacheProfile {
+        u64 hits { 0 };
+        u64 misses { 0 };
+    };
+
+    struct ExecutableProfile {
+        WeakPtr<Executable> executable;
+        String name;
+        u64 runs { 0 };
+        AK::Duration self_time;
+        u64 self_allocated_cells { 0 };
+        Vector<PropertyLookupCacheProfile> property_lookup_caches;
+    };
+
+    struct Frame {
+        Executable const* executable { nullptr };
+        ExecutableProfile* profile { nullptr };
+        MonotonicTime start;
+        AK::Duration time_in_callees;
+        u64 allocated_cells_at_start { 0 };
+        u64 allocated_cells_in_callees { 0 };
+    };
+
+    ExecutableProfile& profile_for(Executable const&);
+    void record_property_lookup_cache_access(PropertyLookupCache const&, bool hit);
+
+    GC::Heap& m_heap;
+    AK::Array<u64, number_of_instruction_types> m_instruction_counts {};
+    HashMap<Executable const*, NonnullOwnPtr<ExecutableProfile>> m_executable_profiles;
+
+    // Profiles of executables that have been garbage collected, whose address may since have been reused.
+    Vector<NonnullOwnPtr<ExecutableProfile>> m_retired_executable_profiles;
+
+    Vector<Frame, 32> m_frames;
+};
+
+}
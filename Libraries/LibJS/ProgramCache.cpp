@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringHash.h>
+#include <LibJS/ProgramCache.h>
+#include <LibJS/SourceCode.h>
+
+namespace JS {
+
+static u32 hash_source_text(StringView source_text)
+{
+    return string_hash(source_text.characters_without_null_termination(), source_text.length());
+}
+
+ProgramCache::~ProgramCache() = default;
+
+RefPtr<Program> ProgramCache::find(Program::Type type, StringView source_text, StringView filename, size_t line_number_offset)
+{
+    if (source_text.length() < minimum_source_length)
+        return nullptr;
+
+    auto source_hash = hash_source_text(source_text);
+
+    for (size_t i = m_entries.size(); i > 0; --i) {
+        auto& entry = m_entries[i - 1];
+        if (entry.source_hash != source_hash || entry.line_number_offset != line_number_offset)
+            continue;
+
+        auto const& program = *entry.program;
+        if (program.type() != type)
+            continue;
+        if (program.source_code().filename() != filename)
+            continue;
+        if (program.source_code().code().bytes_as_string_view() != source_text)
+            continue;
+
+        NonnullRefPtr<Program> result = entry.program;
+        entry.last_used = MonotonicTime::now_coarse();
+
+        // Move the entry to the back to mark it as the most recently used one.
+        if (i != m_entries.size())
+            m_entries.append(m_entries.take(i - 1));
+
+        return result;
+    }
+
+    return nullptr;
+}
+
+void ProgramCache::insert(NonnullRefPtr<Program> program, size_t line_number_offset)
+{
+    auto source_text = program->source_code().code().bytes_as_string_view();
+    if (source_text.length() < minimum_source_length || source_text.length() > maximum_total_source_length)
+        return;
+
+    m_total_source_length += source_text.length();
+    m_entries.append({ hash_source_text(source_text), line_number_offset, MonotonicTime::now_coarse(), move(program) });
+
+    evict_idle_entries();
+    evict_until_under_budget();
+}
+
+void ProgramCache::evict_idle_entries(AK::Duration time_offset)
+{
+    auto now = MonotonicTime::now_coarse() + time_offset;
+
+    // NOTE: The entries are ordered by the time they were last used, so the idle ones are all at the front.
+    size_t entries_to_evict = 0;
+    while (entries_to_evict < m_entries.size() && now - m_entries[entries_to_evict].last_used >= maximum_idle_time)
+        ++entries_to_evict;
+
+    evict_first_entries(entries_to_evict);
+}
+
+void ProgramCache::clear()
+{
+    m_entries.clear();
+    m_total_source_length = 0;
+}
+
+void ProgramCache::evict_until_under_budget()
+{
+    size_t entries_to_evict = 0;
+    size_t total_source_length = m_total_source_length;
+    while (entries_to_evict < m_entries.size()
+        && (total_source_length > maximum_total_source_length || m_entries.size() - entries_to_evict > maximum_number_of_entries)) {
+        total_source_length -= m_entries[entries_to_evict].program->source_code().code().bytes().size();
+        ++entries_to_evict;
+    }
+
+    evict_first_entries(entries_to_evict);
+}
+
+void ProgramCache::evict_first_entries(size_t count)
+{
+    if (count == 0)
+        return;
+
+    for (size_t i = 0; i < count; ++i)
+        m_total_source_length -= m_entries[i].program->source_code().code().bytes().size();
+    m_entries.remove(0, count);
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibJS/AST.h>
+#include <LibJS/Export.h>
+
+namespace JS {
+
+// Keeps recently parsed programs alive, keyed by the content of their source text, so that loading the same
+// script or module again (e.g. when navigating between pages of the same site) can skip lexing and parsing.
+// Since bytecode executables are cached on the AST nodes they were generated from, a cache hit also reuses
+// the bytecode of every function that has already been called at least once.
+class JS_API ProgramCache {
+    AK_MAKE_NONCOPYABLE(ProgramCache);
+    AK_MAKE_NONMOVABLE(ProgramCache);
+
+public:
+    // Sources below this size are cheap enough to parse that caching them would only evict more useful entries.
+    static constexpr size_t minimum_source_length = 1 * KiB;
+    static constexpr size_t maximum_total_source_length = 32 * MiB;
+    static constexpr size_t maximum_number_of_entries = 128;
+
+    // Entries that haven't been used for this long are dropped, so that the cache doesn't keep the programs of pages
+    // that were visited once alive for the whole lifetime of the VM.
+    static constexpr AK::Duration maximum_idle_time = AK::Duration::from_seconds(5 * 60);
+
+    ProgramCache() = default;
+    ~ProgramCache();
+
+    RefPtr<Program> find(Program::Type, StringView source_text, StringView filename, size_t line_number_offset = 1);
+    void insert(NonnullRefPtr<Program>, size_t line_number_offset = 1);
+
+    // Embedders with an event loop should call this periodically while the cache isn't empty. The time offset allows
+    // tests to pretend that time has passed.
+    void evict_idle_entries(AK::Duration time_offset = {});
+
+    void clear();
+    bool is_empty() const { return m_entries.is_empty(); }
+
+private:
+    struct Entry {
+        u32 source_hash { 0 };
+        size_t line_number_offset { 0 };
+        MonotonicTime last_used;
+        NonnullRefPtr<Program> program;
+    };
+
+    void evict_first_entries(size_t count);
+
+    void evict_until_under_budget();
+
+    // Ordered from least to most recently used.
+    Vector<Entry> m_entries;
+    size_t m_total_source_length { 0 };
+};
+
+}
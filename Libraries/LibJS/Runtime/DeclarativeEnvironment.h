@@ -128,6 +128,9 @@ private:
     HashMap<FlyString, size_t> m_bindings_assoc;
     DisposeCapability m_dispose_capability;
 
+    // NOTE: Serial numbers are unique across all environments, since bytecode (and the global variable caches in it)
+    //       may be shared between realms when a cached program is evaluated in more than one of them.
+    static u64 s_next_environment_serial_number;
     u64 m_environment_serial_number { 0 };
 };
 
@@ -481,6 +481,15 @@ void ECMAScriptFunctionObject::initialize(Realm& realm)
     }
 }
 
+// OPTIMIZATION: Once a function's bytecode has been generated and cached, the statements of its body are no longer
+//               needed, so we let go of them. This keeps large, long-lived scripts from holding on to the AST of
+//               every function that has ever been called.
+static void release_function_body_statements(Statement const& ecmascript_code)
+{
+    if (is<ScopeNode>(ecmascript_code))
+        const_cast<ScopeNode&>(static_cast<ScopeNode const&>(ecmascript_code)).release_children();
+}
+
 ThrowCompletionOr<void> ECMAScriptFunctionObject::get_stack_frame_size(size_t& registers_and_constants_and_locals_count, size_t& argument_count)
 {
     if (!m_bytecode_executable) {
@@ -489,6 +498,7 @@ ThrowCompletionOr<void> ECMAScriptFunctionObject::get_stack_frame_size(size_t& r
                 const_cast<Statement&>(ecmascript_code()).set_bytecode_executable(TRY(Bytecode::compile(vm(), ecmascript_code(), kind(), name())));
             } else {
                 const_cast<Statement&>(ecmascript_code()).set_bytecode_executable(TRY(Bytecode::compile(vm(), *this)));
+                release_function_body_statements(ecmascript_code());
             }
         }
         m_bytecode_executable = ecmascript_code().bytecode_executable();
@@ -554,6 +564,7 @@ ThrowCompletionOr<GC::Ref<Object>> ECMAScriptFunctionObject::internal_construct(
                 const_cast<Statement&>(ecmascript_code()).set_bytecode_executable(TRY(Bytecode::compile(vm, ecmascript_code(), kind(), name())));
             } else {
                 const_cast<Statement&>(ecmascript_code()).set_bytecode_executable(TRY(Bytecode::compile(vm, *this)));
+                release_function_body_statements(ecmascript_code());
             }
         }
         m_bytecode_executable = ecmascript_code().bytecode_executable();
@@ -62,6 +62,17 @@ private:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // Tracks what kind of values the storage has seen so far. Transitions only go towards Generic,
+    // except when the storage becomes empty again.
+    enum class ElementsKind : u8 {
+        // Every element is either an Int32 or a hole.
+        Int32,
+        // Every element is either a number (Int32 or double) or a hole.
+        Double,
+        // Elements can be any value.
+        Generic,
+    };
+
     SimpleIndexedPropertyStorage()
         : IndexedPropertyStorage(IsSimpleStorage::Yes)
     {
@@ -95,13 +106,56 @@ public:
 
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    ElementsKind elements_kind() const { return m_elements_kind; }
+
+    // Packed number elements can be neither holes nor accessors, so reading them only needs a bounds check.
+    [[nodiscard]] bool has_packed_number_elements() const
+    {
+        return m_elements_kind != ElementsKind::Generic && !has_empty_elements();
+    }
+
+    // Overwrites an existing element in place if doing so needs no bookkeeping, i.e. the slot isn't a hole
+    // and the new value doesn't change the elements kind. Returns false if the caller has to take the slow path.
+    [[nodiscard]] bool try_fast_put(u32 index, Value value)
+    {
+        if (index >= m_array_size)
+            return false;
+        auto& slot = m_packed_elements.data()[index];
+        switch (m_elements_kind) {
+        case ElementsKind::Int32:
+            if (!value.is_int32())
+                return false;
+            break;
+        case ElementsKind::Double:
+            if (!value.is_number())
+                return false;
+            break;
+        case ElementsKind::Generic:
+            if (value.is_special_empty_value() || slot.is_accessor())
+                return false;
+            break;
+        }
+        if (slot.is_special_empty_value())
+            return false;
+        slot = value;
+        return true;
+    }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    void update_elements_kind(Value value)
+    {
+        if (m_elements_kind == ElementsKind::Generic || value.is_int32() || value.is_special_empty_value())
+            return;
+        m_elements_kind = value.is_number() ? ElementsKind::Double : ElementsKind::Generic;
+    }
+
     Checked<size_t> m_number_of_empty_elements { 0 };
     Vector<Value> m_packed_elements;
+    ElementsKind m_elements_kind { ElementsKind::Int32 };
 };
 
 class GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
@@ -4,12 +4,16 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CharacterTypes.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringConversions.h>
 #include <AK/TypeCasts.h>
+#include <AK/UnicodeUtils.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
 #include <LibJS/Runtime/AbstractOperations.h>
@@ -447,21 +451,391 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     return unfiltered;
 }
 
+// Parses JSON text straight into JS values, without building an intermediate AK::JsonValue tree first.
+class JSONTextParser {
+public:
+    JSONTextParser(VM& vm, StringView text)
+        : m_vm(vm)
+        , m_realm(*vm.current_realm())
+        , m_text(text)
+    {
+    }
+
+    ThrowCompletionOr<Value> parse()
+    {
+        // NOTE: All string values and property keys are created from slices of the input, so validate it once up front.
+        if (!Utf8View { m_text }.validate())
+            return syntax_error();
+
+        skip_whitespace();
+        auto value = TRY(parse_value());
+        skip_whitespace();
+
+        if (m_offset != m_text.length())
+            return syntax_error();
+        return value;
+    }
+
+private:
+    static constexpr size_t maximum_number_of_cached_property_keys = 1024;
+
+    Completion syntax_error()
+    {
+        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    }
+
+    char peek(size_t offset = 0) const
+    {
+        if (m_offset + offset >= m_text.length())
+            return '\0';
+        return m_text[m_offset + offset];
+    }
+
+    bool consume_specific(char ch)
+    {
+        if (peek() != ch)
+            return false;
+        ++m_offset;
+        return true;
+    }
+
+    void skip_whitespace()
+    {
+        while (m_offset < m_text.length()) {
+            auto ch = m_text[m_offset];
+            if (ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r')
+                break;
+            ++m_offset;
+        }
+    }
+
+    void skip_digits()
+    {
+        while (is_ascii_digit(peek()))
+            ++m_offset;
+    }
+
+    ThrowCompletionOr<Value> parse_value()
+    {
+        switch (peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"':
+            return parse_string();
+        case 't':
+            return parse_literal("true"sv, Value(true));
+        case 'f':
+            return parse_literal("false"sv, Value(false));
+        case 'n':
+            return parse_literal("null"sv, js_null());
+        default:
+            if (peek() == '-' || is_ascii_digit(peek()))
+                return parse_number();
+            return syntax_error();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_literal(StringView literal, Value value)
+    {
+        if (!m_text.substring_view(m_offset).starts_with(literal))
+            return syntax_error();
+        m_offset += literal.length();
+        return value;
+    }
+
+    ThrowCompletionOr<Value> parse_object()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        ++m_offset; // '{'
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+
+        skip_whitespace();
+        if (consume_specific('}'))
+            return object;
+
+        for (;;) {
+            if (peek() != '"')
+                return syntax_error();
+            auto key = TRY(parse_property_key());
+
+            skip_whitespace();
+            if (!consume_specific(':'))
+                return syntax_error();
+            skip_whitespace();
+
+            // NOTE: Objects that share a sequence of keys end up sharing shapes through the transition chain, and
+            //       duplicate keys overwrite the earlier value in place, as required by the spec.
+            auto value = TRY(parse_value());
+            object->define_direct_property(key, value, default_attributes);
+
+            skip_whitespace();
+            if (consume_specific('}'))
+                return object;
+            if (!consume_specific(','))
+                return syntax_error();
+            skip_whitespace();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_array()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        ++m_offset; // '['
+        auto array = MUST(Array::create(m_realm, 0));
+
+        skip_whitespace();
+        if (consume_specific(']'))
+            return array;
+
+        for (;;) {
+            // OPTIMIZATION: The elements of a freshly created array are always packed, so we can append to its storage
+            //               directly instead of going through the generic property definition path.
+            auto element = TRY(parse_value());
+            array->indexed_properties().append(element);
+
+            skip_whitespace();
+            if (consume_specific(']'))
+                return array;
+            if (!consume_specific(','))
+                return syntax_error();
+            skip_whitespace();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_number()
+    {
+        auto start = m_offset;
+        bool is_negative = consume_specific('-');
+
+        if (consume_specific('0')) {
+            if (is_ascii_digit(peek()))
+                return syntax_error();
+        } else if (is_ascii_digit(peek())) {
+            skip_digits();
+        } else {
+            return syntax_error();
+        }
+
+        bool is_integer = true;
+
+        if (consume_specific('.')) {
+            if (!is_ascii_digit(peek()))
+                return syntax_error();
+            skip_digits();
+            is_integer = false;
+        }
+
+        if (consume_specific('e') || consume_specific('E')) {
+            if (!consume_specific('+'))
+                consume_specific('-');
+            if (!is_ascii_digit(peek()))
+                return syntax_error();
+            skip_digits();
+            is_integer = false;
+        }
+
+        auto number_text = m_text.substring_view(start, m_offset - start);
+
+        // OPTIMIZATION: Integers of up to 15 digits are exactly representable as a double, so we can accumulate them
+        //               directly instead of going through the general floating point parser.
+        if (auto digits = number_text.substring_view(is_negative ? 1 : 0); is_integer && digits.length() <= 15) {
+            u64 value = 0;
+            for (auto digit : digits)
+                value = value * 10 + parse_ascii_digit(digit);
+
+            auto result = static_cast<double>(value);
+            return Value(is_negative ? -result : result);
+        }
+
+        auto result = parse_first_number<double>(number_text, TrimWhitespace::No);
+        if (!result.has_value() || result->characters_parsed != number_text.length())
+            return syntax_error();
+        return Value(result->value);
+    }
+
+    // Returns the offset of the first byte at or after the given offset that cannot appear unescaped within a string,
+    // i.e. a quotation mark, a reverse solidus or a control character.
+    size_t find_end_of_unescaped_characters(size_t offset) const
+    {
+        static constexpr u64 ones = 0x0101010101010101ull;
+        static constexpr u64 high_bits = 0x8080808080808080ull;
+
+        auto has_zero_byte = [](u64 chunk) { return ((chunk - ones) & ~chunk & high_bits) != 0; };
+        auto has_byte_less_than = [](u64 chunk, u8 value) { return ((chunk - ones * value) & ~chunk & high_bits) != 0; };
+
+        auto const* characters = reinterpret_cast<u8 const*>(m_text.characters_without_null_termination());
+        auto length = m_text.length();
+
+        // OPTIMIZATION: Strings are usually long runs of plain characters, so check eight bytes at a time until we
+        //               find a chunk that contains any byte we have to look at more closely.
+        for (; offset + sizeof(u64) <= length; offset += sizeof(u64)) {
+            u64 chunk;
+            __builtin_memcpy(&chunk, characters + offset, sizeof(chunk));
+
+            if (has_byte_less_than(chunk, 0x20) || has_zero_byte(chunk ^ (ones * '"')) || has_zero_byte(chunk ^ (ones * '\\')))
+                break;
+        }
+
+        for (; offset < length; ++offset) {
+            auto ch = characters[offset];
+            if (ch == '"' || ch == '\\' || is_ascii_c0_control(ch))
+                break;
+        }
+
+        return offset;
+    }
+
+    ThrowCompletionOr<u16> parse_unicode_escape_code_unit()
+    {
+        if (m_offset + 4 > m_text.length())
+            return syntax_error();
+
+        u16 code_unit = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            auto ch = m_text[m_offset++];
+            if (!is_ascii_hex_digit(ch))
+                return syntax_error();
+            code_unit = (code_unit << 4) | parse_ascii_hex_digit(ch);
+        }
+
+        return code_unit;
+    }
+
+    // Appends the contents of the string starting at the current offset (just past the opening quotation mark) to the
+    // builder, and consumes the closing quotation mark.
+    ThrowCompletionOr<void> unescape_string_contents(StringBuilder& builder)
+    {
+        for (;;) {
+            auto end = find_end_of_unescaped_characters(m_offset);
+            builder.append(m_text.substring_view(m_offset, end - m_offset));
+            m_offset = end;
+
+            if (m_offset == m_text.length())
+                return syntax_error();
+
+            auto ch = m_text[m_offset++];
+            if (ch == '"')
+                return {};
+            if (ch != '\\')
+                return syntax_error();
+
+            switch (peek()) {
+            case '"':
+            case '\\':
+            case '/':
+                builder.append(m_text[m_offset++]);
+                break;
+            case 'b':
+                ++m_offset;
+                builder.append('\b');
+                break;
+            case 'f':
+                ++m_offset;
+                builder.append('\f');
+                break;
+            case 'n':
+                ++m_offset;
+                builder.append('\n');
+                break;
+            case 'r':
+                ++m_offset;
+                builder.append('\r');
+                break;
+            case 't':
+                ++m_offset;
+                builder.append('\t');
+                break;
+            case 'u': {
+                ++m_offset;
+                auto code_unit = TRY(parse_unicode_escape_code_unit());
+
+                if (AK::UnicodeUtils::is_utf16_high_surrogate(code_unit) && peek() == '\\' && peek(1) == 'u') {
+                    auto offset_before_low_surrogate = m_offset;
+                    m_offset += 2;
+
+                    auto low_surrogate = TRY(parse_unicode_escape_code_unit());
+                    if (AK::UnicodeUtils::is_utf16_low_surrogate(low_surrogate)) {
+                        builder.append_code_point(AK::UnicodeUtils::decode_utf16_surrogate_pair(code_unit, low_surrogate));
+                        break;
+                    }
+
+                    m_offset = offset_before_low_surrogate;
+                }
+
+                // NOTE: Unpaired surrogates are kept as they are, like everywhere else we convert JS strings to UTF-8.
+                builder.append_code_point(code_unit);
+                break;
+            }
+            default:
+                return syntax_error();
+            }
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_string()
+    {
+        auto start = ++m_offset; // '"'
+
+        // OPTIMIZATION: Most strings contain no escape sequences, so they can be created from the input text directly.
+        if (auto end = find_end_of_unescaped_characters(start); peek(end - m_offset) == '"') {
+            m_offset = end + 1;
+            return PrimitiveString::create(m_vm, String::from_utf8_without_validation(m_text.substring_view(start, end - start).bytes()));
+        }
+
+        StringBuilder builder;
+        TRY(unescape_string_contents(builder));
+        return PrimitiveString::create(m_vm, builder.to_string_without_validation());
+    }
+
+    ThrowCompletionOr<PropertyKey> parse_property_key()
+    {
+        auto start = ++m_offset; // '"'
+
+        if (auto end = find_end_of_unescaped_characters(start); peek(end - m_offset) == '"') {
+            m_offset = end + 1;
+            auto key_text = m_text.substring_view(start, end - start);
+
+            // OPTIMIZATION: Large documents tend to repeat the same keys in many objects, so remember the property keys
+            //               we've created to avoid allocating and interning a new string for every occurrence.
+            if (auto it = m_property_key_cache.find(key_text); it != m_property_key_cache.end())
+                return it->value;
+
+            PropertyKey key { String::from_utf8_without_validation(key_text.bytes()) };
+            if (m_property_key_cache.size() < maximum_number_of_cached_property_keys)
+                m_property_key_cache.set(key_text, key);
+            return key;
+        }
+
+        StringBuilder builder;
+        TRY(unescape_string_contents(builder));
+        return PropertyKey { builder.to_string_without_validation() };
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    StringView m_text;
+    size_t m_offset { 0 };
+    HashMap<StringView, PropertyKey> m_property_key_cache;
+};
+
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
-
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-
     // 2. Let scriptString be the string-concatenation of "(", text, and ");".
     // 3. Let script be ParseText(scriptString, Script).
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    // NOTE: Validating and evaluating the JSON text happen in a single pass, creating JS values as we go.
+    JSONTextParser parser { vm, text };
+    auto result = TRY(parser.parse());
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
@@ -4,6 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <LibJS/Runtime/Map.h>
 
 namespace JS {
@@ -20,74 +24,192 @@ Map::Map(Object& prototype)
 {
 }
 
+static constexpr u8 control_empty = 0x80;
+static constexpr u8 control_deleted = 0xfe;
+
+// Slots holding an entry have the high bit of their control byte clear, and store the low 7 bits of the entry's hash.
+static ALWAYS_INLINE u8 control_for_hash(unsigned hash) { return hash & 0x7f; }
+static ALWAYS_INLINE size_t group_for_hash(unsigned hash) { return hash >> 7; }
+
+static ALWAYS_INLINE u16 to_bitmask(AK::SIMD::c8x16 matches)
+{
+#if defined(__SSE2__)
+    return __builtin_ia32_pmovmskb128(matches);
+#else
+    u16 mask = 0;
+    for (size_t i = 0; i < 16; ++i)
+        mask |= (matches[i] & 1) << i;
+    return mask;
+#endif
+}
+
+static ALWAYS_INLINE u16 match_control_byte(u8 const* group, u8 control)
+{
+    auto controls = AK::SIMD::load_unaligned<AK::SIMD::u8x16>(group);
+    return to_bitmask(bit_cast<AK::SIMD::c8x16>(controls == control));
+}
+
+static ALWAYS_INLINE u16 match_free_slots(u8 const* group)
+{
+    // NOTE: Both control_empty and control_deleted have the high bit set.
+    auto controls = AK::SIMD::load_unaligned<AK::SIMD::u8x16>(group);
+    return to_bitmask(bit_cast<AK::SIMD::c8x16>((controls & 0x80) != 0));
+}
+
+Optional<size_t> Map::find_slot(Value const& key, unsigned hash) const
+{
+    if (m_index_control.is_empty())
+        return {};
+
+    auto group_mask = m_index_control.size() / index_group_size - 1;
+    auto group = group_for_hash(hash) & group_mask;
+
+    // NOTE: Triangular probing visits every group exactly once, as the number of groups is a power of two.
+    for (size_t probe = 1;; ++probe) {
+        auto const* controls = m_index_control.data() + group * index_group_size;
+        for (auto matches = match_control_byte(controls, control_for_hash(hash)); matches != 0; matches &= matches - 1) {
+            auto slot = group * index_group_size + count_trailing_zeroes(matches);
+            auto const& entry = m_entries[m_index_slots[slot]];
+            if (entry.hash == hash && ValueTraits::equals(entry.key, key))
+                return slot;
+        }
+
+        // An empty slot would have ended the probe sequence for the key when it was inserted, so it can't be further along.
+        if (match_control_byte(controls, control_empty) != 0)
+            return {};
+
+        group = (group + probe) & group_mask;
+    }
+}
+
+size_t Map::find_free_slot(unsigned hash) const
+{
+    auto group_mask = m_index_control.size() / index_group_size - 1;
+    auto group = group_for_hash(hash) & group_mask;
+
+    for (size_t probe = 1;; ++probe) {
+        if (auto free_slots = match_free_slots(m_index_control.data() + group * index_group_size); free_slots != 0)
+            return group * index_group_size + count_trailing_zeroes(free_slots);
+        group = (group + probe) & group_mask;
+    }
+}
+
+void Map::rebuild_index(size_t minimum_size)
+{
+    if (m_size != m_entries.size()) {
+        m_entries.remove_all_matching([](auto const& entry) { return entry.is_deleted(); });
+        ++m_epoch;
+    }
+
+    // Leave the index at most half full, so that it can take as many insertions again before it has to be rebuilt.
+    size_t capacity = index_group_size;
+    while (capacity / 2 < minimum_size)
+        capacity *= 2;
+
+    m_index_control.resize(capacity);
+    m_index_control.fill(control_empty);
+    m_index_slots.resize(capacity);
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        auto hash = m_entries[i].hash;
+        auto slot = find_free_slot(hash);
+        m_index_control[slot] = control_for_hash(hash);
+        m_index_slots[slot] = i;
+    }
+}
+
+size_t Map::first_entry_index_not_below(size_t insertion_id) const
+{
+    // NOTE: The entries are always sorted by insertion id, as compaction preserves their order.
+    size_t low = 0;
+    size_t high = m_entries.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (m_entries[middle].insertion_id < insertion_id)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
+    // NOTE: m_next_insertion_id is left alone, so that active iterators go on to visit entries added after this.
     m_entries.clear();
+    m_index_control.clear();
+    m_index_slots.clear();
+    m_size = 0;
+    ++m_epoch;
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
-    if (!index.has_value())
+    auto slot = find_slot(key, ValueTraits::hash(key));
+    if (!slot.has_value())
         return false;
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
+    // NOTE: The entry stays in place as a hole, so that active iterators pointing past it don't shift.
+    auto& entry = m_entries[m_index_slots[*slot]];
+    entry.key = js_special_empty_value();
+    entry.value = js_undefined();
+    m_index_control[*slot] = control_deleted;
+
+    // Once the last entry is gone there is nothing left to preserve, so release the storage right away.
+    if (--m_size == 0)
+        map_clear();
     return true;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto slot = find_slot(key, ValueTraits::hash(key)); slot.has_value())
+        return m_entries[m_index_slots[*slot]].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_slot(key, ValueTraits::hash(key)).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
+    auto hash = ValueTraits::hash(key);
+    if (auto slot = find_slot(key, hash); slot.has_value()) {
+        m_entries[m_index_slots[*slot]].value = value;
+        return;
     }
+
+    // Keep the index at most 7/8 full (counting the slots of deleted entries), so every probe sequence ends at an empty slot.
+    // If most entries have been deleted, the rebuild squeezes them out instead of growing the index.
+    if ((m_entries.size() + 1) * 8 > m_index_control.size() * 7)
+        rebuild_index(m_size + 1);
+
+    auto slot = find_free_slot(hash);
+    m_index_control[slot] = control_for_hash(hash);
+    m_index_slots[slot] = m_entries.size();
+    m_entries.append({ key, value, m_next_insertion_id++, hash });
+    ++m_size;
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_size;
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& entry : m_entries) {
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
 }
 
 }
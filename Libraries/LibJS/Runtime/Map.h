@@ -6,8 +6,7 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -32,6 +31,11 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    struct Entry {
+        Value key;
+        Value value;
+    };
+
     struct EndIterator {
     };
 
@@ -39,29 +43,27 @@ public:
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_next_element();
+            return m_position >= m_map->m_entries.size();
         }
 
         IteratorImpl& operator++()
-        {
-            ++m_index;
-            return *this;
-        }
-
-        decltype(auto) operator*()
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            if (m_position < m_map->m_entries.size())
+                m_insertion_id = m_map->m_entries[m_position++].insertion_id + 1;
+            return *this;
         }
 
-        decltype(auto) operator*() const
+        // NOTE: Entries are returned by value, as running user code while iterating may add to the map and move its storage.
+        Entry operator*() const
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            auto const& entry = m_map->m_entries[m_position];
+            return { entry.key, entry.value };
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        bool operator==(IteratorImpl const& other) const { return m_insertion_id == other.m_insertion_id && m_map.ptr() == other.m_map.ptr(); }
         bool operator==(EndIterator const&) const { return is_end(); }
 
     private:
@@ -69,35 +71,38 @@ public:
         IteratorImpl(Map const& map)
         requires(IsConst)
             : m_map(map)
+            , m_epoch(map.m_epoch)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
+            , m_epoch(map.m_epoch)
         {
-            ensure_index();
-        }
-
-        void ensure_index() const
-        {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
         }
 
         void ensure_next_element() const
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            auto const& entries = m_map->m_entries;
+
+            // If the entries have been compacted or cleared since we last looked, our cached position is stale,
+            // so find the first entry that was inserted no earlier than the one we were going to visit next.
+            if (m_epoch != m_map->m_epoch) {
+                m_position = m_map->first_entry_index_not_below(m_insertion_id);
+                m_epoch = m_map->m_epoch;
+            }
+
+            while (m_position < entries.size() && entries[m_position].is_deleted())
+                ++m_position;
+
+            m_insertion_id = m_position < entries.size() ? entries[m_position].insertion_id : m_map->m_next_insertion_id;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
-        mutable size_t m_index { 0 };
+        mutable size_t m_insertion_id { 0 };
+        mutable size_t m_position { 0 };
+        mutable u64 m_epoch { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -111,9 +116,39 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
+    // The entries are kept in a dense vector in insertion order, which is what iteration walks. Removing an entry
+    // only marks it as deleted, so that active iterators keep their place; the holes are squeezed out when the
+    // index next needs to grow.
+    // The index is an open-addressed hash table of entry indices, probed a group of slots at a time like a Swiss
+    // table: each slot has a control byte holding either a marker or the low 7 bits of its key's hash, which lets
+    // us compare a whole group of slots against a key with a single vector comparison.
+    struct StoredEntry {
+        Value key;
+        Value value;
+        size_t insertion_id { 0 };
+        unsigned hash { 0 };
+
+        bool is_deleted() const { return key.is_special_empty_value(); }
+    };
+
+    static constexpr size_t index_group_size = 16;
+
+    Optional<size_t> find_slot(Value const& key, unsigned hash) const;
+    size_t find_free_slot(unsigned hash) const;
+    void rebuild_index(size_t minimum_size);
+    size_t first_entry_index_not_below(size_t insertion_id) const;
+
+    Vector<StoredEntry> m_entries;
+    size_t m_size { 0 };
     size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+
+    // Bumped whenever entries move to a different position, which invalidates the positions cached by iterators.
+    u64 m_epoch { 0 };
+
+    // NOTE: Every entry, deleted or not, occupies one slot until the next rebuild, so the number of used slots
+    //       never exceeds m_entries.size().
+    Vector<u8> m_index_control;
+    Vector<u32> m_index_slots;
 };
 
 }
@@ -144,6 +144,13 @@ String PrimitiveString::utf8_string() const
     return *m_utf8_string;
 }
 
+FlyString PrimitiveString::utf8_fly_string() const
+{
+    FlyString fly_string { utf8_string() };
+    m_utf8_string = fly_string.to_string();
+    return fly_string;
+}
+
 StringView PrimitiveString::utf8_string_view() const
 {
     (void)utf8_string();
@@ -170,6 +177,8 @@ Utf16View PrimitiveString::utf16_string_view() const
 
 size_t PrimitiveString::length_in_utf16_code_units() const
 {
+    if (m_is_rope)
+        return static_cast<RopeString const&>(*this).length_in_utf16_code_units();
     return utf16_string_view().length_in_code_units();
 }
 
@@ -215,43 +224,115 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
     rope_string.resolve(preference);
 }
 
-void RopeString::resolve(EncodingPreference preference) const
+// Calls the callback for every node below this one, from left to right. Returning false when called for a rope skips
+// its children.
+template<typename Callback>
+void RopeString::for_each_piece(Callback callback) const
 {
-
-    // This vector will hold all the pieces of the rope that need to be assembled
-    // into the resolved string.
-    Vector<PrimitiveString const*> pieces;
-    size_t approximate_length = 0;
-
     // NOTE: We traverse the rope tree without using recursion, since we'd run out of
     //       stack space quickly when handling a long sequence of unresolved concatenations.
-    Vector<PrimitiveString const*> stack;
+    Vector<PrimitiveString const*, 32> stack;
     stack.append(m_rhs);
     stack.append(m_lhs);
     while (!stack.is_empty()) {
         auto const* current = stack.take_last();
-        if (current->m_is_rope) {
-            auto& current_rope_string = static_cast<RopeString const&>(*current);
-            stack.append(current_rope_string.m_rhs);
-            stack.append(current_rope_string.m_lhs);
+        if (!callback(*current) || !current->m_is_rope)
             continue;
+        auto& current_rope_string = static_cast<RopeString const&>(*current);
+        stack.append(current_rope_string.m_rhs);
+        stack.append(current_rope_string.m_lhs);
+    }
+}
+
+size_t RopeString::length_in_utf16_code_units() const
+{
+    if (m_length_in_utf16_code_units.has_value())
+        return *m_length_in_utf16_code_units;
+
+    // NOTE: Concatenating UTF-16 strings never changes the number of code units, even when a surrogate pair ends up
+    //       being split across two pieces, so we can add up the lengths of the pieces without resolving the rope.
+    //       This keeps loops like `while (s.length < n) s += x;` from flattening the whole rope on every iteration.
+    size_t length = 0;
+    for_each_piece([&](PrimitiveString const& piece) {
+        if (piece.m_is_rope) {
+            auto const& rope = static_cast<RopeString const&>(piece);
+            if (!rope.m_length_in_utf16_code_units.has_value())
+                return true;
+            length += *rope.m_length_in_utf16_code_units;
+            return false;
         }
+        if (piece.has_utf16_string())
+            length += piece.m_utf16_string->length_in_code_units();
+        else
+            length += utf16_code_unit_length_from_utf8(piece.m_utf8_string->bytes_as_string_view());
+        return true;
+    });
 
-        if (current->has_utf8_string())
-            approximate_length += current->utf8_string_view().length();
-        pieces.append(current);
+    m_length_in_utf16_code_units = length;
+    return length;
+}
+
+static Optional<u32> utf16_low_surrogate_at_start(PrimitiveString const& piece)
+{
+    if (piece.has_utf16_string()) {
+        auto code_unit = piece.utf16_string_view().code_unit_at(0);
+        if (!AK::UnicodeUtils::is_utf16_low_surrogate(code_unit))
+            return {};
+        return code_unit;
     }
 
+    // Surrogates encoded as UTF-8 are 3 bytes.
+    auto string = piece.utf8_string_view();
+    if (string.length() < 3 || (static_cast<u8>(string[0]) & 0xf0) != 0xe0)
+        return {};
+    auto code_point = *Utf8View(string).begin();
+    if (!AK::UnicodeUtils::is_utf16_low_surrogate(code_point))
+        return {};
+    return code_point;
+}
+
+static Optional<u32> utf16_high_surrogate_at_end(StringView string)
+{
+    // Surrogates encoded as UTF-8 are 3 bytes.
+    if (string.length() < 3 || (static_cast<u8>(string[string.length() - 3]) & 0xf0) != 0xe0)
+        return {};
+    auto code_point = *Utf8View(string.substring_view(string.length() - 3)).begin();
+    if (!AK::UnicodeUtils::is_utf16_high_surrogate(code_point))
+        return {};
+    return code_point;
+}
+
+void RopeString::resolve(EncodingPreference preference) const
+{
+    // This vector will hold all the pieces of the rope that need to be assembled
+    // into the resolved string.
+    Vector<PrimitiveString const*> pieces;
+
+    // We size the builder up front so that the resolved string is allocated exactly once. Lengths of pieces that are
+    // not in the preferred encoding are estimated by their length in the other one, which is exact for ASCII.
+    size_t capacity = 0;
+
+    for_each_piece([&](PrimitiveString const& piece) {
+        if (piece.m_is_rope)
+            return true;
+        if (piece.has_utf16_string() && (preference == EncodingPreference::UTF16 || !piece.has_utf8_string()))
+            capacity += piece.m_utf16_string->length_in_code_units();
+        else
+            capacity += piece.m_utf8_string->bytes_as_string_view().length();
+        pieces.append(&piece);
+        return true;
+    });
+
     if (preference == EncodingPreference::UTF16) {
         // The caller wants a UTF-16 string, so we can simply concatenate all the pieces
         // into a UTF-16 code unit buffer and create a Utf16String from it.
-        StringBuilder builder(StringBuilder::Mode::UTF16);
+        StringBuilder builder(StringBuilder::Mode::UTF16, capacity);
 
         for (auto const* current : pieces) {
-            if (current->has_utf8_string())
-                builder.append(current->utf8_string_view());
+            if (current->has_utf16_string())
+                builder.append(*current->m_utf16_string);
             else
-                builder.append(current->utf16_string_view());
+                builder.append(current->m_utf8_string->bytes_as_string_view());
         }
 
         m_utf16_string = builder.to_utf16_string_without_validation();
@@ -262,64 +343,33 @@ void RopeString::resolve(EncodingPreference preference) const
     }
 
     // Now that we have all the pieces, we can concatenate them using a StringBuilder.
-    StringBuilder builder(approximate_length);
+    // NOTE: Pieces are appended in whichever encoding they already have, so that we don't leave a UTF-8 copy of every
+    //       UTF-16 piece behind.
+    StringBuilder builder(capacity);
 
-    // We keep track of the previous piece in order to handle surrogate pairs spread across two pieces.
-    PrimitiveString const* previous = nullptr;
     for (auto const* current : pieces) {
-        if (!previous) {
-            // This is the very first piece, just append it and continue.
-            builder.append(current->utf8_string());
-            previous = current;
-            continue;
-        }
-
-        // Get the UTF-8 representations for both strings.
-        auto current_string_as_utf8 = current->utf8_string_view();
-        auto previous_string_as_utf8 = previous->utf8_string_view();
-
-        // NOTE: Now we need to look at the end of the previous string and the start
-        //       of the current string, to see if they should be combined into a surrogate.
-
-        // Surrogates encoded as UTF-8 are 3 bytes.
-        if ((previous_string_as_utf8.length() < 3) || (current_string_as_utf8.length() < 3)) {
-            builder.append(current_string_as_utf8);
-            previous = current;
-            continue;
-        }
-
-        // Might the previous string end with a UTF-8 encoded surrogate?
-        if ((static_cast<u8>(previous_string_as_utf8[previous_string_as_utf8.length() - 3]) & 0xf0) != 0xe0) {
-            // If not, just append the current string and continue.
-            builder.append(current_string_as_utf8);
-            previous = current;
-            continue;
-        }
-
-        // Might the current string begin with a UTF-8 encoded surrogate?
-        if ((static_cast<u8>(current_string_as_utf8[0]) & 0xf0) != 0xe0) {
-            // If not, just append the current string and continue.
-            builder.append(current_string_as_utf8);
-            previous = current;
-            continue;
-        }
-
-        auto high_surrogate = *Utf8View(previous_string_as_utf8.substring_view(previous_string_as_utf8.length() - 3)).begin();
-        auto low_surrogate = *Utf8View(current_string_as_utf8).begin();
+        // A lone high surrogate at the end of what we have so far and a lone low surrogate at the start of the current
+        // piece have to be combined into a single code point.
+        auto low_surrogate = utf16_low_surrogate_at_start(*current);
+        auto high_surrogate = low_surrogate.has_value() ? utf16_high_surrogate_at_end(builder.string_view()) : Optional<u32> {};
 
-        if (!AK::UnicodeUtils::is_utf16_high_surrogate(high_surrogate) || !AK::UnicodeUtils::is_utf16_low_surrogate(low_surrogate)) {
-            builder.append(current_string_as_utf8);
-            previous = current;
+        if (!high_surrogate.has_value()) {
+            if (current->has_utf8_string())
+                builder.append(current->m_utf8_string->bytes_as_string_view());
+            else
+                builder.append(*current->m_utf16_string);
             continue;
         }
 
         // Remove 3 bytes from the builder and replace them with the UTF-8 encoded code point.
         builder.trim(3);
-        builder.append_code_point(AK::UnicodeUtils::decode_utf16_surrogate_pair(high_surrogate, low_surrogate));
+        builder.append_code_point(AK::UnicodeUtils::decode_utf16_surrogate_pair(*high_surrogate, *low_surrogate));
 
         // Append the remaining part of the current string.
-        builder.append(current_string_as_utf8.substring_view(3));
-        previous = current;
+        if (current->has_utf8_string())
+            builder.append(current->m_utf8_string->bytes_as_string_view().substring_view(3));
+        else
+            builder.append(current->m_utf16_string->substring_view(1));
     }
 
     // NOTE: We've already produced valid UTF-8 above, so there's no need for additional validation.
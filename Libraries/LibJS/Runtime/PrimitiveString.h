@@ -46,6 +46,10 @@ public:
     [[nodiscard]] StringView utf8_string_view() const;
     bool has_utf8_string() const { return m_utf8_string.has_value(); }
 
+    // Interns the string, and keeps the interned copy for ourselves, so that using this string as a property key
+    // again doesn't have to look it up in the FlyString table.
+    [[nodiscard]] FlyString utf8_fly_string() const;
+
     [[nodiscard]] Utf16String utf16_string() const;
     [[nodiscard]] Utf16View utf16_string_view() const;
     bool has_utf16_string() const { return m_utf16_string.has_value(); }
@@ -97,9 +101,14 @@ private:
     virtual void visit_edges(Visitor&) override;
 
     void resolve(EncodingPreference) const;
+    size_t length_in_utf16_code_units() const;
+
+    template<typename Callback>
+    void for_each_piece(Callback) const;
 
     mutable GC::Ptr<PrimitiveString> m_lhs;
     mutable GC::Ptr<PrimitiveString> m_rhs;
+    mutable Optional<size_t> m_length_in_utf16_code_units;
 };
 
 }
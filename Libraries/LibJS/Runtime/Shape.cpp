@@ -5,6 +5,7 @@
  */
 
 #include <LibGC/DeferGC.h>
+#include <LibGC/HeapBlock.h>
 #include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/VM.h>
 
@@ -53,6 +54,8 @@ GC::Ptr<Shape> Shape::get_or_prune_cached_forward_transition(TransitionKey const
 {
     if (m_is_prototype_shape)
         return nullptr;
+    if (auto* shape = m_first_forward_transition.ptr(); shape && *shape->m_property_key == key.property_key && shape->m_attributes == key.attributes)
+        return shape;
     if (!m_forward_transitions)
         return nullptr;
     auto it = m_forward_transitions->find(key);
@@ -66,6 +69,18 @@ GC::Ptr<Shape> Shape::get_or_prune_cached_forward_transition(TransitionKey const
     return it->value.ptr();
 }
 
+void Shape::add_forward_transition(TransitionKey const& key, Shape& shape)
+{
+    // NOTE: A stale inline transition can simply be replaced, as there's no table entry to prune.
+    if (!m_first_forward_transition) {
+        m_first_forward_transition = shape;
+        return;
+    }
+    if (!m_forward_transitions)
+        m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
+    m_forward_transitions->set(key, shape);
+}
+
 GC::Ptr<Shape> Shape::get_or_prune_cached_delete_transition(PropertyKey const& key)
 {
     if (m_is_prototype_shape)
@@ -107,11 +122,8 @@ GC::Ref<Shape> Shape::create_put_transition(PropertyKey const& property_key, Pro
         return *existing_shape;
     auto new_shape = heap().allocate<Shape>(*this, property_key, attributes, TransitionType::Put);
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
-    if (!m_is_prototype_shape) {
-        if (!m_forward_transitions)
-            m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-        m_forward_transitions->set(key, new_shape.ptr());
-    }
+    if (!m_is_prototype_shape)
+        add_forward_transition(key, *new_shape);
     return new_shape;
 }
 
@@ -122,11 +134,8 @@ GC::Ref<Shape> Shape::create_configure_transition(PropertyKey const& property_ke
         return *existing_shape;
     auto new_shape = heap().allocate<Shape>(*this, property_key, attributes, TransitionType::Configure);
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
-    if (!m_is_prototype_shape) {
-        if (!m_forward_transitions)
-            m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-        m_forward_transitions->set(key, new_shape.ptr());
-    }
+    if (!m_is_prototype_shape)
+        add_forward_transition(key, *new_shape);
     return new_shape;
 }
 
@@ -215,12 +224,61 @@ Optional<PropertyMetadata> Shape::lookup(PropertyKey const& property_key) const
 {
     if (m_property_count == 0)
         return {};
+    // OPTIMIZATION: Walking the chain is only worth it for shapes that are looked up a few times (e.g. while an object
+    //               is being built up). Once a shape has been looked up this often, it's hot enough to warrant a table.
+    // NOTE: This limit is a heuristic, it hasn't been tuned against benchmarks.
+    static constexpr u8 max_transition_chain_lookups = 16;
+    if (!m_property_table && m_transition_chain_lookup_count < max_transition_chain_lookups) {
+        ++m_transition_chain_lookup_count;
+        if (auto property = lookup_in_transition_chain(property_key); property.has_value())
+            return property.release_value();
+    }
     auto property = property_table().get(property_key);
     if (!property.has_value())
         return {};
     return property;
 }
 
+// OPTIMIZATION: Every shape with a property table holds a full copy of it, so building one for each shape along a
+//               transition chain costs quadratic memory. Instead, a few steps of the chain are walked back to the
+//               nearest shape that already has a table. Returns an empty Optional if that's not possible, in which
+//               case this shape needs a table of its own.
+Optional<Optional<PropertyMetadata>> Shape::lookup_in_transition_chain(PropertyKey const& property_key) const
+{
+    // NOTE: Like the lookup limit above, this is a heuristic that hasn't been tuned against benchmarks.
+    static constexpr size_t max_transition_chain_steps = 8;
+
+    Optional<PropertyAttributes> configured_attributes;
+    size_t steps = 0;
+    for (auto const* shape = this; shape; shape = shape->m_previous) {
+        if (shape->m_property_table) {
+            auto property = shape->m_property_table->get(property_key);
+            if (property.has_value() && configured_attributes.has_value())
+                property->attributes = *configured_attributes;
+            return property;
+        }
+        if (++steps > max_transition_chain_steps)
+            return {};
+
+        // NOTE: Deletions shift the offsets of the properties after them, so we leave those to the property table.
+        if (shape->m_transition_type == TransitionType::Delete)
+            return {};
+        if (!shape->m_property_key.has_value() || *shape->m_property_key != property_key)
+            continue;
+
+        // The most recent configure transition decides the attributes, but the offset comes from the put transition.
+        if (shape->m_transition_type == TransitionType::Configure) {
+            if (!configured_attributes.has_value())
+                configured_attributes = shape->m_attributes;
+            continue;
+        }
+
+        VERIFY(shape->m_transition_type == TransitionType::Put);
+        return PropertyMetadata { shape->m_property_count - 1, configured_attributes.value_or(shape->m_attributes) };
+    }
+    return Optional<PropertyMetadata> {};
+}
+
 FLATTEN OrderedHashMap<PropertyKey, PropertyMetadata> const& Shape::property_table() const
 {
     ensure_property_table();
@@ -378,4 +436,60 @@ void Shape::invalidate_all_prototype_chains_leading_to_this()
     }
 }
 
+template<typename Map>
+static size_t estimated_hash_map_bytes(Map const& map, size_t bucket_overhead)
+{
+    return sizeof(Map) + map.capacity() * (sizeof(typename Map::KeyType) + sizeof(typename Map::ValueType) + bucket_overhead);
+}
+
+ShapeMemoryReport Shape::compute_memory_report(GC::Heap& heap)
+{
+    ShapeMemoryReport report;
+    heap.for_each_live_cell([&](GC::Cell* cell) {
+        auto* shape = as_if<Shape>(*cell);
+        if (!shape)
+            return;
+
+        ++report.shape_count;
+        report.shape_bytes += GC::HeapBlock::from_cell(cell)->cell_size();
+        if (shape->m_dictionary)
+            ++report.dictionary_shape_count;
+        if (shape->m_is_prototype_shape)
+            ++report.prototype_shape_count;
+
+        if (shape->m_property_table) {
+            ++report.property_table_count;
+            report.property_table_entry_count += shape->m_property_table->size();
+            report.property_table_bytes += estimated_hash_map_bytes(*shape->m_property_table, 2 * sizeof(void*) + 1);
+        }
+
+        if (shape->m_first_forward_transition)
+            ++report.inline_transition_count;
+
+        auto add_transition_table = [&](auto const& transitions) {
+            if (!transitions)
+                return;
+            ++report.transition_table_count;
+            report.transition_table_entry_count += transitions->size();
+            report.transition_table_bytes += estimated_hash_map_bytes(*transitions, 1);
+        };
+        add_transition_table(shape->m_forward_transitions);
+        add_transition_table(shape->m_prototype_transitions);
+        add_transition_table(shape->m_delete_transitions);
+    });
+    return report;
+}
+
+void ShapeMemoryReport::dump() const
+{
+    dbgln("Shape memory report");
+    dbgln("=============================================");
+    dbgln("            Shapes: {} ({} bytes, {} dictionaries, {} prototypes)", shape_count, shape_bytes, dictionary_shape_count, prototype_shape_count);
+    dbgln("   Property tables: {} ({} entries, ~{} bytes)", property_table_count, property_table_entry_count, property_table_bytes);
+    dbgln("Inline transitions: {}", inline_transition_count);
+    dbgln(" Transition tables: {} ({} entries, ~{} bytes)", transition_table_count, transition_table_entry_count, transition_table_bytes);
+    dbgln("             Total: ~{} bytes", total_bytes());
+    dbgln("=============================================");
+}
+
 }
@@ -35,6 +35,25 @@ struct TransitionKey {
     }
 };
 
+struct ShapeMemoryReport {
+    size_t shape_count { 0 };
+    size_t dictionary_shape_count { 0 };
+    size_t prototype_shape_count { 0 };
+    size_t shape_bytes { 0 };
+
+    size_t property_table_count { 0 };
+    size_t property_table_entry_count { 0 };
+    size_t property_table_bytes { 0 };
+
+    size_t inline_transition_count { 0 };
+    size_t transition_table_count { 0 };
+    size_t transition_table_entry_count { 0 };
+    size_t transition_table_bytes { 0 };
+
+    size_t total_bytes() const { return shape_bytes + property_table_bytes + transition_table_bytes; }
+    void dump() const;
+};
+
 class PrototypeChainValidity final : public Cell
     , public Weakable<PrototypeChainValidity> {
     GC_CELL(PrototypeChainValidity, Cell);
@@ -106,6 +125,8 @@ public:
 
     void set_prototype_without_transition(Object* new_prototype);
 
+    static ShapeMemoryReport compute_memory_report(GC::Heap&);
+
 private:
     explicit Shape(Realm&);
     Shape(Shape& previous_shape, PropertyKey const& property_key, PropertyAttributes attributes, TransitionType);
@@ -120,6 +141,9 @@ private:
     [[nodiscard]] GC::Ptr<Shape> get_or_prune_cached_forward_transition(TransitionKey const&);
     [[nodiscard]] GC::Ptr<Shape> get_or_prune_cached_prototype_transition(Object* prototype);
     [[nodiscard]] GC::Ptr<Shape> get_or_prune_cached_delete_transition(PropertyKey const&);
+    void add_forward_transition(TransitionKey const&, Shape&);
+
+    [[nodiscard]] Optional<Optional<PropertyMetadata>> lookup_in_transition_chain(PropertyKey const&) const;
 
     void ensure_property_table() const;
 
@@ -127,6 +151,9 @@ private:
 
     mutable OwnPtr<OrderedHashMap<PropertyKey, PropertyMetadata>> m_property_table;
 
+    // NOTE: The first forward transition is kept inline, since most shapes never get a second one.
+    //       Its transition key is the property key and attributes of the shape it leads to.
+    WeakPtr<Shape> m_first_forward_transition;
     OwnPtr<HashMap<TransitionKey, WeakPtr<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<GC::Ptr<Object>, WeakPtr<Shape>>> m_prototype_transitions;
     OwnPtr<HashMap<PropertyKey, WeakPtr<Shape>>> m_delete_transitions;
@@ -141,6 +168,10 @@ private:
     PropertyAttributes m_attributes { 0 };
     TransitionType m_transition_type { TransitionType::Invalid };
 
+    // NOTE: Counts lookups that were answered from the transition chain, so that frequently used shapes eventually
+    //       get a property table of their own instead of walking the chain every time.
+    mutable u8 m_transition_chain_lookup_count { 0 };
+
     bool m_dictionary : 1 { false };
     bool m_cacheable : 1 { true };
     bool m_is_prototype_shape : 1 { false };
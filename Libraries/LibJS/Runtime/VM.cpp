@@ -16,6 +16,7 @@
 #include <LibFileSystem/FileSystem.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
@@ -70,6 +71,7 @@ VM::VM(ErrorMessages error_messages)
     , m_error_messages(move(error_messages))
 {
     m_bytecode_interpreter = make<Bytecode::Interpreter>(*this);
+    m_program_cache = make<ProgramCache>();
 
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
 
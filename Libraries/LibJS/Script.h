@@ -39,6 +39,7 @@ public:
     static Result<GC::Ref<Script>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1);
 
     Realm& realm() { return *m_realm; }
+    Program& parse_node() { return *m_parse_node; }
     Program const& parse_node() const { return *m_parse_node; }
     Vector<ModuleWithSpecifier>& loaded_modules() { return m_loaded_modules; }
     Vector<ModuleWithSpecifier> const& loaded_modules() const { return m_loaded_modules; }
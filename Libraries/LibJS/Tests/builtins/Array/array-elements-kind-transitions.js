@@ -0,0 +1,74 @@
+describe("elements kind transitions", () => {
+    test("int32 elements transition to doubles", () => {
+        const a = [1, 2, 3];
+        a[1] = 2.5;
+        expect(a).toEqual([1, 2.5, 3]);
+        a[0] = -0;
+        expect(Object.is(a[0], -0)).toBeTrue();
+        a[2] = 4;
+        expect(a).toEqual([-0, 2.5, 4]);
+    });
+
+    test("number elements transition to generic values", () => {
+        const a = [1, 2.5, 3];
+        a[0] = "foo";
+        a[1] = undefined;
+        a[2] = null;
+        expect(a).toEqual(["foo", undefined, null]);
+        a[0] = 1;
+        expect(a[0]).toBe(1);
+    });
+
+    test("holes are not read as numbers", () => {
+        const a = [1, 2, 3];
+        delete a[1];
+        expect(a[1]).toBeUndefined();
+        expect(1 in a).toBeFalse();
+        a[1] = 5;
+        expect(a).toEqual([1, 5, 3]);
+        expect(1 in a).toBeTrue();
+    });
+
+    test("holes fall back to the prototype chain", () => {
+        const a = [1, , 3];
+        Array.prototype[1] = "from prototype";
+        try {
+            expect(a[1]).toBe("from prototype");
+            a[1] = 2;
+            expect(a[1]).toBe(2);
+            expect(Array.prototype[1]).toBe("from prototype");
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+
+    test("out of bounds accesses", () => {
+        const a = [1, 2, 3];
+        expect(a[3]).toBeUndefined();
+        a[5] = 6;
+        expect(a).toHaveLength(6);
+        expect(a[4]).toBeUndefined();
+        expect(a[5]).toBe(6);
+    });
+
+    test("emptied arrays can hold any kind of value", () => {
+        const a = [1.5, "foo"];
+        a.length = 0;
+        a[0] = 1;
+        a[1] = 2;
+        a[0] = 3;
+        expect(a).toEqual([3, 2]);
+        a[1] = {};
+        expect(typeof a[1]).toBe("object");
+    });
+
+    test("frozen arrays are not written to", () => {
+        const a = Object.freeze([1, 2, 3]);
+        a[0] = 5;
+        expect(a[0]).toBe(1);
+        expect(() => {
+            "use strict";
+            a[0] = 5;
+        }).toThrow(TypeError);
+    });
+});
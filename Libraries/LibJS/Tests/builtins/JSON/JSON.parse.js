@@ -74,3 +74,62 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("string escapes", () => {
+    expect(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"')).toBe('"\\/\b\f\n\r\t');
+    expect(JSON.parse('"\\u0041\\u00e9\\u20AC"')).toBe("Aé€");
+    expect(JSON.parse('"\\ud83d\\ude00"')).toBe("😀");
+    expect(JSON.parse('"a long string with an escape at the very end\\n"')).toBe(
+        "a long string with an escape at the very end\n"
+    );
+});
+
+test("repeated and duplicate keys", () => {
+    const array = JSON.parse('[{"a":1,"b":2},{"a":3,"b":4},{"b":5,"a":6}]');
+    expect(Object.keys(array[0])).toEqual(["a", "b"]);
+    expect(Object.keys(array[1])).toEqual(["a", "b"]);
+    expect(Object.keys(array[2])).toEqual(["b", "a"]);
+    expect(array[1].b).toBe(4);
+
+    const object = JSON.parse('{"a":1,"b":2,"a":3}');
+    expect(Object.keys(object)).toEqual(["a", "b"]);
+    expect(object.a).toBe(3);
+
+    expect(JSON.parse('{"0":"x","1":"y"}')[1]).toBe("y");
+});
+
+test("numbers", () => {
+    expect(JSON.parse("0")).toBe(0);
+    expect(JSON.parse("-12")).toBe(-12);
+    expect(JSON.parse("1.5e3")).toBe(1500);
+    expect(JSON.parse("2E-2")).toBe(0.02);
+    expect(JSON.parse("1e400")).toBe(Infinity);
+    expect(JSON.parse("123456789012345")).toBe(123456789012345);
+    expect(JSON.parse("1234567890123456789")).toBe(1234567890123456789);
+});
+
+test("more syntax errors", () => {
+    [
+        "01",
+        "-",
+        "1.",
+        "1e",
+        "1e+",
+        ".5",
+        "+1",
+        '"unterminated',
+        '"\\x"',
+        '"\\u12"',
+        '"\t"',
+        "[1 2]",
+        '{"a" 1}',
+        '{"a":1 "b":2}',
+        "tru",
+        "nul",
+        "[] []",
+    ].forEach(test => {
+        expect(() => {
+            JSON.parse(test);
+        }).toThrow(SyntaxError);
+    });
+});
@@ -10,3 +10,21 @@ test("basic functionality", () => {
     map.clear();
     expect(map).toHaveSize(0);
 });
+
+test("active iterators visit entries added after clearing", () => {
+    const map = new Map([
+        [1, 2],
+        [3, 4],
+    ]);
+    const iterator = map.entries();
+
+    expect(iterator.next()).toBeIteratorResultWithValue([1, 2]);
+
+    map.clear();
+    map.set(5, 6);
+    map.set(1, 7);
+
+    expect(iterator.next()).toBeIteratorResultWithValue([5, 6]);
+    expect(iterator.next()).toBeIteratorResultWithValue([1, 7]);
+    expect(iterator.next()).toBeIteratorResultDone();
+});
@@ -83,3 +83,69 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
     });
 });
+
+describe("many deletions", () => {
+    test("re-added keys move to the end", () => {
+        const map = new Map([
+            ["a", 0],
+            ["b", 1],
+            ["c", 2],
+        ]);
+        expect(map.delete("a")).toBeTrue();
+        map.set("a", 3);
+        expect(Array.from(map.keys())).toEqual(["b", "c", "a"]);
+        expect(map.get("a")).toBe(3);
+    });
+
+    test("order and lookups survive repeated deletions and insertions", () => {
+        const map = new Map();
+        for (let i = 0; i < 1000; ++i) map.set(i, i);
+        for (let i = 0; i < 1000; ++i) {
+            if (i % 10 !== 0) expect(map.delete(i)).toBeTrue();
+        }
+        for (let i = 1000; i < 2000; ++i) map.set(i, i);
+
+        expect(map).toHaveSize(1100);
+        for (let i = 0; i < 2000; ++i) expect(map.has(i)).toBe(i >= 1000 || i % 10 === 0);
+
+        let previous = -1;
+        for (const [key, value] of map) {
+            expect(key).toBe(value);
+            expect(key).toBeGreaterThan(previous);
+            previous = key;
+        }
+    });
+
+    test("active iterators keep their place while deleted entries are squeezed out", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+        const iterator = map.keys();
+
+        expect(iterator.next()).toBeIteratorResultWithValue(0);
+        expect(iterator.next()).toBeIteratorResultWithValue(1);
+
+        for (let i = 0; i < 100; ++i) {
+            if (i !== 50) map.delete(i);
+        }
+        for (let i = 100; i < 1000; ++i) map.set(i, i);
+
+        expect(iterator.next()).toBeIteratorResultWithValue(50);
+        for (let i = 100; i < 1000; ++i) expect(iterator.next()).toBeIteratorResultWithValue(i);
+        expect(iterator.next()).toBeIteratorResultDone();
+    });
+
+    test("deleting every key while iterating", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+
+        const visited = [];
+        for (const [key] of map) {
+            visited.push(key);
+            map.delete(key);
+            if (key < 50) map.set(key + 100, key + 100);
+        }
+
+        expect(visited).toHaveLength(150);
+        expect(map).toHaveSize(0);
+    });
+});
@@ -0,0 +1,56 @@
+test("one call site calling functions with different frame layouts", () => {
+    const functions = [
+        () => 1,
+        (a, b, c, d, e) => [a, b, c, d, e],
+        function (a) {
+            let x = a,
+                y = a * 2,
+                z = a * 3;
+            return x + y + z;
+        },
+        (...rest) => rest.length,
+        Math.max,
+        a => a,
+    ];
+
+    const call = (f, argument) => f(argument);
+
+    for (let round = 0; round < 3; ++round) {
+        expect(call(functions[0], 5)).toBe(1);
+        expect(call(functions[1], 5)).toEqual([5, undefined, undefined, undefined, undefined]);
+        expect(call(functions[2], 5)).toBe(30);
+        expect(call(functions[3], 5)).toBe(1);
+        expect(call(functions[4], 5)).toBe(5);
+        expect(call(functions[5], 5)).toBe(5);
+    }
+});
+
+test("one call site calling many closures of the same function", () => {
+    const makeAdder = n => x => x + n;
+    const adders = [];
+    for (let i = 0; i < 10; ++i) adders.push(makeAdder(i));
+
+    const call = (f, argument) => f(argument);
+    for (let i = 0; i < 10; ++i) expect(call(adders[i], 1)).toBe(i + 1);
+});
+
+test("callee that becomes unreachable is not called again", () => {
+    const call = f => f();
+    for (let i = 0; i < 5; ++i) {
+        const value = i;
+        expect(call(() => value)).toBe(i);
+        gc();
+    }
+});
+
+test("class constructors still throw when called without new through a warm call site", () => {
+    const call = f => f();
+    function ordinary() {
+        return 1;
+    }
+    class C {}
+    expect(call(ordinary)).toBe(1);
+    expect(call(ordinary)).toBe(1);
+    expect(() => call(C)).toThrowWithMessage(TypeError, "Class constructor C must be called with 'new'");
+    expect(() => call(C)).toThrowWithMessage(TypeError, "Class constructor C must be called with 'new'");
+});
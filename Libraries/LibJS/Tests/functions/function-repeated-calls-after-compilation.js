@@ -0,0 +1,32 @@
+test("nested functions, classes and blocks survive repeated calls", () => {
+    function outer(value) {
+        function declared() {
+            return value;
+        }
+        const expression = () => value * 2;
+        class Holder {
+            get() {
+                return value * 3;
+            }
+        }
+        {
+            let scoped = value * 4;
+            function inBlock() {
+                return scoped;
+            }
+            return [declared(), expression(), new Holder().get(), inBlock()];
+        }
+    }
+
+    expect(outer(1)).toEqual([1, 2, 3, 4]);
+    expect(outer(2)).toEqual([2, 4, 6, 8]);
+    expect(outer(3)).toEqual([3, 6, 9, 12]);
+});
+
+test("function source text is unaffected by compilation", () => {
+    function f(a) {
+        return a + 1;
+    }
+    expect(f(1)).toBe(2);
+    expect(f.toString()).toBe("function f(a) {\n        return a + 1;\n    }");
+});
@@ -0,0 +1,94 @@
+describe("objects built up through shape transitions", () => {
+    test("many properties added one by one", () => {
+        const a = {};
+        const b = {};
+        for (let i = 0; i < 40; ++i) {
+            a["p" + i] = i;
+            b["p" + i] = i * 2;
+        }
+        for (let i = 0; i < 40; ++i) {
+            expect(a["p" + i]).toBe(i);
+            expect(b["p" + i]).toBe(i * 2);
+        }
+        expect(Object.keys(a)).toHaveLength(40);
+        expect(Object.keys(a)[39]).toBe("p39");
+        expect(a.missing).toBeUndefined();
+    });
+
+    test("objects diverging from a shared transition chain", () => {
+        const make = last => {
+            const o = { x: 1, y: 2 };
+            o[last] = 3;
+            return o;
+        };
+        const a = make("z");
+        const b = make("w");
+        expect(Object.keys(a)).toEqual(["x", "y", "z"]);
+        expect(Object.keys(b)).toEqual(["x", "y", "w"]);
+        expect(a.w).toBeUndefined();
+        expect(b.z).toBeUndefined();
+        expect(b.w).toBe(3);
+    });
+
+    test("reconfigured properties", () => {
+        const o = { a: 1, b: 2, c: 3 };
+        Object.defineProperty(o, "b", { enumerable: false });
+        expect(o.b).toBe(2);
+        expect(Object.keys(o)).toEqual(["a", "c"]);
+        Object.defineProperty(o, "b", { writable: false });
+        o.b = 5;
+        expect(o.b).toBe(2);
+        expect(Object.getOwnPropertyDescriptor(o, "b")).toEqual({
+            value: 2,
+            writable: false,
+            enumerable: false,
+            configurable: true,
+        });
+        o.d = 4;
+        expect(o.d).toBe(4);
+        expect(o.c).toBe(3);
+    });
+
+    test("deleted properties", () => {
+        const o = { a: 1, b: 2, c: 3 };
+        delete o.b;
+        expect(o.b).toBeUndefined();
+        expect(o.c).toBe(3);
+        o.d = 4;
+        expect(o.d).toBe(4);
+        expect(Object.keys(o)).toEqual(["a", "c", "d"]);
+        o.b = 5;
+        expect(Object.keys(o)).toEqual(["a", "c", "d", "b"]);
+        expect(o.b).toBe(5);
+    });
+
+    test("prototype changes in the middle of a chain", () => {
+        const o = { a: 1 };
+        Object.setPrototypeOf(o, { inherited: true });
+        o.b = 2;
+        expect(o.a).toBe(1);
+        expect(o.b).toBe(2);
+        expect(o.inherited).toBeTrue();
+        expect(Object.keys(o)).toEqual(["a", "b"]);
+    });
+
+    test("frequently used shapes", () => {
+        const objects = [];
+        for (let i = 0; i < 100; ++i) {
+            const o = { a: i, b: i + 1 };
+            Object.defineProperty(o, "a", { writable: false });
+            o.c = i + 2;
+            objects.push(o);
+        }
+
+        for (let i = 0; i < objects.length; ++i) {
+            const o = objects[i];
+            o.a = -1;
+            expect(o.a).toBe(i);
+            expect(o["b"]).toBe(i + 1);
+            expect(o["c"]).toBe(i + 2);
+            expect(Object.getOwnPropertyDescriptor(o, "a").writable).toBeFalse();
+            expect(Object.hasOwn(o, "d")).toBeFalse();
+        }
+    });
+});
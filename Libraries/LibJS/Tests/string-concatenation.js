@@ -28,3 +28,40 @@ test("adding strings with dangling surrogates", () => {
     expect("\ud834a" + "\udf06").toBe("\ud834a\udf06");
     expect("\ud834" + "a\udf06").toBe("\ud834a\udf06");
 });
+
+test("dangling surrogates spread across many pieces", () => {
+    let s = "x";
+    for (let i = 0; i < 4; ++i) s += "\ud834" + "\udf06";
+    expect(s).toBe("x𝌆𝌆𝌆𝌆");
+    expect(s.length).toBe(9);
+    expect(s.codePointAt(1)).toBe(0x1d306);
+
+    const utf16 = String.fromCharCode(0xd834);
+    const combined = "ab" + utf16 + "\udf06" + "cd";
+    expect(combined.length).toBe(6);
+    expect(combined).toBe("ab𝌆cd");
+});
+
+test("length of a string built in a loop", () => {
+    let s = "";
+    let expectedLength = 0;
+    while (s.length < 10000) {
+        s += "abc";
+        s += "ä";
+        s += "😀";
+        expectedLength += 6;
+        expect(s.length).toBe(expectedLength);
+    }
+    expect(s).toBe("abcä😀".repeat(expectedLength / 6));
+});
+
+test("strings built by concatenation as property keys", () => {
+    const object = {};
+    for (let i = 0; i < 10; ++i) object["long property name " + i] = i;
+    for (let i = 0; i < 10; ++i) {
+        const key = "long property name " + i;
+        expect(object[key]).toBe(i);
+        expect(object[key]).toBe(i);
+        expect(key).toBe(`long property name ${i}`);
+    }
+});
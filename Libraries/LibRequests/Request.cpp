@@ -4,11 +4,17 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
 #include <LibRequests/Request.h>
 #include <LibRequests/RequestClient.h>
 
 namespace Requests {
 
+// The Content-Length is only used to size the buffer up front. Larger bodies still grow it as they come in, so a
+// bogus Content-Length can't make us allocate a huge buffer before any data has arrived.
+static constexpr size_t maximum_preallocated_payload_size = 4 * MiB;
+
 Request::Request(RequestClient& client, i32 request_id)
     : m_client(client)
     , m_request_id(request_id)
@@ -28,6 +34,41 @@ bool Request::stop()
     return m_client->stop_request({}, *this);
 }
 
+void Request::set_priority(RequestPriority priority)
+{
+    m_client->set_request_priority({}, *this, priority);
+}
+
+void Request::suspend()
+{
+    if (!m_internal_stream_data)
+        return;
+
+    m_internal_stream_data->is_suspended = true;
+    m_internal_stream_data->read_notifier->set_enabled(false);
+}
+
+void Request::resume()
+{
+    if (!m_internal_stream_data || !m_internal_stream_data->is_suspended)
+        return;
+
+    m_internal_stream_data->is_suspended = false;
+
+    // If we haven't received the response fd yet, there is nothing to read.
+    if (!m_internal_stream_data->read_stream)
+        return;
+
+    m_internal_stream_data->read_notifier->set_enabled(true);
+
+    // NOTE: RequestServer won't wake us up for data it wrote to the response ring while we weren't waiting for it, so
+    //       read whatever is available now, rather than waiting for the notifier to fire.
+    Core::deferred_invoke([self = NonnullRefPtr { *this }] {
+        if (self->m_internal_stream_data && !self->m_internal_stream_data->is_suspended)
+            self->m_internal_stream_data->read_notifier->on_activation();
+    });
+}
+
 void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
 {
     // If the request was stopped while this IPC was in-flight, just bail.
@@ -40,10 +81,45 @@ void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
     auto notifier = Core::Notifier::construct(fd, Core::Notifier::Type::Read);
     auto stream = MUST(Core::File::adopt_fd(fd, Core::File::OpenMode::Read));
     notifier->on_activation = move(m_internal_stream_data->read_notifier->on_activation);
+    if (m_internal_stream_data->is_suspended)
+        notifier->set_enabled(false);
     m_internal_stream_data->read_notifier = move(notifier);
     m_internal_stream_data->read_stream = move(stream);
 }
 
+void Request::set_response_ring(Badge<RequestClient>, Core::AnonymousBuffer ring, int writer_wake_up_fd)
+{
+    // NOTE: Once RequestServer has set up the ring, the response body is only ever written to the ring. If we can't use
+    //       it, we close the wake-up fd right away, which tells RequestServer to fail the request rather than wait for
+    //       us to make room in the ring.
+
+    // If the request was stopped while this IPC was in-flight, just bail.
+    if (!m_internal_stream_data) {
+        (void)Core::System::close(writer_wake_up_fd);
+        return;
+    }
+
+    auto response_ring = Core::SharedRingBuffer::attach(move(ring));
+    if (response_ring.is_error()) {
+        dbgln("Request: Received an invalid response ring: {}", response_ring.error());
+        (void)Core::System::close(writer_wake_up_fd);
+        return;
+    }
+
+    auto writer_wake_up = Core::File::adopt_fd(writer_wake_up_fd, Core::File::OpenMode::Write);
+    if (writer_wake_up.is_error()) {
+        dbgln("Request: Unable to adopt the response ring's wake-up fd: {}", writer_wake_up.error());
+        (void)Core::System::close(writer_wake_up_fd);
+        return;
+    }
+
+    m_internal_stream_data->response_ring = response_ring.release_value();
+    m_internal_stream_data->response_ring_writer_wake_up = writer_wake_up.release_value();
+
+    // RequestServer may already have written to the ring, but it won't wake us up until we've said that we're waiting.
+    m_internal_stream_data->read_notifier->on_activation();
+}
+
 void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_buffered_request_finished)
 {
     VERIFY(m_mode == Mode::Unknown);
@@ -52,15 +128,18 @@ void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_
     m_internal_buffered_data = make<InternalBufferedData>();
 
     on_headers_received = [this](auto& headers, auto response_code, auto const& reason_phrase) {
+        // NOTE: The Content-Length is only a hint, as the body may be transferred compressed.
+        if (auto content_length = headers.get("Content-Length"sv); content_length.has_value()) {
+            if (auto size = content_length->template to_number<size_t>(); size.has_value())
+                (void)m_internal_buffered_data->payload.try_ensure_capacity(min(*size, maximum_preallocated_payload_size));
+        }
+
         m_internal_buffered_data->response_headers = headers;
         m_internal_buffered_data->response_code = move(response_code);
         m_internal_buffered_data->reason_phrase = reason_phrase;
     };
 
     on_finish = [this, on_buffered_request_finished = move(on_buffered_request_finished)](auto total_size, auto& timing_info, auto network_error) {
-        auto output_buffer = ByteBuffer::create_uninitialized(m_internal_buffered_data->payload_stream.used_buffer_size()).release_value_but_fixme_should_propagate_errors();
-        m_internal_buffered_data->payload_stream.read_until_filled(output_buffer).release_value_but_fixme_should_propagate_errors();
-
         on_buffered_request_finished(
             total_size,
             timing_info,
@@ -68,12 +147,12 @@ void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_
             m_internal_buffered_data->response_headers,
             m_internal_buffered_data->response_code,
             m_internal_buffered_data->reason_phrase,
-            output_buffer);
+            m_internal_buffered_data->payload);
     };
 
     set_up_internal_stream_data([this](auto read_bytes) {
         // FIXME: What do we do if this fails?
-        m_internal_buffered_data->payload_stream.write_until_depleted(read_bytes).release_value_but_fixme_should_propagate_errors();
+        m_internal_buffered_data->payload.try_append(read_bytes).release_value_but_fixme_should_propagate_errors();
     });
 }
 
@@ -137,7 +216,13 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
         if (!m_internal_stream_data)
             return;
 
-        if (!m_internal_stream_data->user_finish_called && (!m_internal_stream_data->read_stream || m_internal_stream_data->read_stream->is_eof())) {
+        auto is_eof = [&] {
+            if (m_internal_stream_data->response_ring.has_value())
+                return m_internal_stream_data->response_ring->is_eof();
+            return !m_internal_stream_data->read_stream || m_internal_stream_data->read_stream->is_eof();
+        };
+
+        if (!m_internal_stream_data->user_finish_called && is_eof()) {
             m_internal_stream_data->user_finish_called = true;
             user_on_finish(m_internal_stream_data->total_size, m_internal_stream_data->timing_info, m_internal_stream_data->network_error);
         }
@@ -151,6 +236,9 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
         if (!m_internal_stream_data)
             return;
 
+        if (m_internal_stream_data->is_suspended)
+            return;
+
         do {
             auto result = m_internal_stream_data->read_stream->read_some({ buffer, buffer_size });
             if (result.is_error() && (!result.error().is_errno() || (result.error().is_errno() && result.error().code() != EINTR)))
@@ -162,9 +250,28 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
             if (read_bytes.is_empty())
                 break;
 
+            // NOTE: Once the response is streamed through a ring, the stream only carries wake-ups.
+            if (m_internal_stream_data->response_ring.has_value())
+                continue;
+
             on_data_available(read_bytes);
+
+            // If the request was stopped from within the callback, just bail.
+            if (!m_internal_stream_data)
+                return;
+
+            if (m_internal_stream_data->is_suspended)
+                break;
         } while (true);
 
+        // NOTE: The ring is read after the wake-ups, so that if RequestServer has already closed the stream, we know
+        //       that we've seen everything it wrote to the ring.
+        if (m_internal_stream_data->response_ring.has_value() && !m_internal_stream_data->is_suspended) {
+            read_from_response_ring(on_data_available);
+            if (!m_internal_stream_data)
+                return;
+        }
+
         if (m_internal_stream_data->read_stream->is_eof())
             m_internal_stream_data->read_notifier->close();
 
@@ -173,4 +280,38 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
     };
 }
 
+void Request::read_from_response_ring(DataReceived const& on_data_available)
+{
+    // NOTE: Keep the ring mapped, even if the request is stopped from within the callback.
+    auto ring = *m_internal_stream_data->response_ring;
+
+    while (true) {
+        for (auto bytes = ring.readable_bytes(); !bytes.is_empty(); bytes = ring.readable_bytes()) {
+            on_data_available(bytes);
+            ring.did_read(bytes.size());
+
+            // If the request was stopped from within the callback, just bail.
+            if (!m_internal_stream_data)
+                return;
+
+            if (ring.take_writer_waiting()) {
+                // NOTE: If the pipe is full, RequestServer has yet to read the wake-ups we sent before, so it will be woken up anyway.
+                u8 const wake_up = 0;
+                (void)m_internal_stream_data->response_ring_writer_wake_up->write_some({ &wake_up, 1 });
+            }
+
+            // NOTE: We don't tell RequestServer that we're waiting for more data, we'll come back to the ring once resumed.
+            if (m_internal_stream_data->is_suspended)
+                return;
+        }
+
+        // Let RequestServer know that we want to be woken up when there is more data. It may have written some in the
+        // meantime, in which case we have to read it now, as it won't know that we're waiting.
+        ring.set_reader_waiting(true);
+        if (ring.readable_bytes().is_empty())
+            break;
+        ring.set_reader_waiting(false);
+    }
+}
+
 }
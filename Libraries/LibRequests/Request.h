@@ -12,9 +12,12 @@
 #include <AK/MemoryStream.h>
 #include <AK/RefCounted.h>
 #include <AK/WeakPtr.h>
+#include <LibCore/File.h>
 #include <LibCore/Notifier.h>
+#include <LibCore/SharedRingBuffer.h>
 #include <LibHTTP/HeaderMap.h>
 #include <LibRequests/NetworkError.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibRequests/RequestTimingInfo.h>
 
 namespace Requests {
@@ -37,6 +40,14 @@ public:
     int fd() const { return m_fd; }
     bool stop();
 
+    // Changes the priority of a request that is in flight, e.g. when the image it is loading scrolls into view.
+    void set_priority(RequestPriority);
+
+    // Stops reading the response until the request is resumed. RequestServer will in turn stop receiving the response
+    // once it has queued up enough of it, so this can be used to keep a slow consumer from buffering the whole response.
+    void suspend();
+    void resume();
+
     using BufferedRequestFinished = Function<void(u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error, HTTP::HeaderMap const& response_headers, Optional<u32> response_code, Optional<String> reason_phrase, ReadonlyBytes payload)>;
 
     // Configure the request such that the entirety of the response data is buffered. The callback receives that data and
@@ -59,11 +70,13 @@ public:
 
     RefPtr<Core::Notifier>& write_notifier(Badge<RequestClient>) { return m_write_notifier; }
     void set_request_fd(Badge<RequestClient>, int fd);
+    void set_response_ring(Badge<RequestClient>, Core::AnonymousBuffer ring, int writer_wake_up_fd);
 
 private:
     explicit Request(RequestClient&, i32 request_id);
 
     void set_up_internal_stream_data(DataReceived on_data_available);
+    void read_from_response_ring(DataReceived const& on_data_available);
 
     WeakPtr<RequestClient> m_client;
     int m_request_id { -1 };
@@ -81,7 +94,7 @@ private:
     RequestFinished on_finish;
 
     struct InternalBufferedData {
-        AllocatingMemoryStream payload_stream;
+        ByteBuffer payload;
         HTTP::HeaderMap response_headers;
         Optional<u32> response_code;
         Optional<String> reason_phrase;
@@ -98,6 +111,11 @@ private:
         RequestTimingInfo timing_info;
         Function<void()> on_finish {};
         bool user_finish_called { false };
+        bool is_suspended { false };
+
+        // Set for responses whose body is streamed through shared memory. The read stream then only carries wake-ups.
+        Optional<Core::SharedRingBuffer> response_ring;
+        OwnPtr<Core::File> response_ring_writer_wake_up;
     };
 
     OwnPtr<InternalBufferedData> m_internal_buffered_data;
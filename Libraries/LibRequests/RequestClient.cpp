@@ -28,7 +28,12 @@ void RequestClient::ensure_connection(URL::URL const& url, ::RequestServer::Cach
     async_ensure_connection(url, cache_level);
 }
 
-RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data)
+void RequestClient::clear_compression_dictionaries()
+{
+    async_clear_compression_dictionaries();
+}
+
+RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data, RequestPriority priority, Optional<String> const& compression_dictionary_partition)
 {
     auto body_result = ByteBuffer::copy(request_body);
     if (body_result.is_error())
@@ -37,7 +42,7 @@ RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL
     static i32 s_next_request_id = 0;
     auto request_id = s_next_request_id++;
 
-    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data);
+    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data, priority, compression_dictionary_partition);
     auto request = Request::create_from_id({}, *this, request_id);
     m_requests.set(request_id, request);
     return request;
@@ -55,6 +60,17 @@ void RequestClient::request_started(i32 request_id, IPC::File response_file)
     request.value()->set_request_fd({}, response_fd);
 }
 
+void RequestClient::response_ring_available(i32 request_id, Core::AnonymousBuffer ring, IPC::File writer_wake_up_file)
+{
+    auto request = m_requests.get(request_id);
+    if (!request.has_value()) {
+        warnln("Received response ring for non-existent request {}", request_id);
+        return;
+    }
+
+    request.value()->set_response_ring({}, move(ring), writer_wake_up_file.take_fd());
+}
+
 bool RequestClient::stop_request(Badge<Request>, Request& request)
 {
     if (!m_requests.contains(request.id()))
@@ -62,6 +78,13 @@ bool RequestClient::stop_request(Badge<Request>, Request& request)
     return IPCProxy::stop_request(request.id());
 }
 
+void RequestClient::set_request_priority(Badge<Request>, Request& request, RequestPriority priority)
+{
+    if (!m_requests.contains(request.id()))
+        return;
+    async_set_request_priority(request.id(), priority);
+}
+
 bool RequestClient::set_certificate(Badge<Request>, Request& request, ByteString certificate, ByteString key)
 {
     if (!m_requests.contains(request.id()))
@@ -111,11 +134,19 @@ void RequestClient::websocket_connected(i64 websocket_id)
         maybe_connection.value()->did_open({});
 }
 
-void RequestClient::websocket_received(i64 websocket_id, bool is_text, ByteBuffer data)
+void RequestClient::websocket_received(i64 websocket_id, bool is_text, IPC::LargeBytes data)
 {
     auto maybe_connection = m_websockets.get(websocket_id);
-    if (maybe_connection.has_value())
-        maybe_connection.value()->did_receive({}, move(data), is_text);
+    if (!maybe_connection.has_value())
+        return;
+
+    auto buffer = data.release_byte_buffer();
+    if (buffer.is_error()) {
+        dbgln("Unable to receive a WebSocket message of {} bytes: {}", data.size(), buffer.error());
+        return;
+    }
+
+    maybe_connection.value()->did_receive({}, buffer.release_value(), is_text);
 }
 
 void RequestClient::websocket_errored(i64 websocket_id, i32 message)
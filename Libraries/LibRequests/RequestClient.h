@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <LibHTTP/HeaderMap.h>
 #include <LibIPC/ConnectionToServer.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibRequests/RequestTimingInfo.h>
 #include <LibRequests/WebSocket.h>
 #include <LibWebSocket/WebSocket.h>
@@ -30,25 +31,29 @@ public:
     explicit RequestClient(NonnullOwnPtr<IPC::Transport>);
     virtual ~RequestClient() override;
 
-    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {});
+    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {}, RequestPriority = RequestPriority::Medium, Optional<String> const& compression_dictionary_partition = {});
 
     RefPtr<WebSocket> websocket_connect(const URL::URL&, ByteString const& origin = {}, Vector<ByteString> const& protocols = {}, Vector<ByteString> const& extensions = {}, HTTP::HeaderMap const& request_headers = {});
 
     void ensure_connection(URL::URL const&, ::RequestServer::CacheLevel);
 
+    void clear_compression_dictionaries();
+
     bool stop_request(Badge<Request>, Request&);
+    void set_request_priority(Badge<Request>, Request&, RequestPriority);
     bool set_certificate(Badge<Request>, Request&, ByteString, ByteString);
 
 private:
     virtual void die() override;
 
     virtual void request_started(i32, IPC::File) override;
+    virtual void response_ring_available(i32, Core::AnonymousBuffer, IPC::File) override;
     virtual void request_finished(i32, u64, RequestTimingInfo, Optional<NetworkError>) override;
     virtual void certificate_requested(i32) override;
     virtual void headers_became_available(i32, HTTP::HeaderMap, Optional<u32>, Optional<String>) override;
 
     virtual void websocket_connected(i64 websocket_id) override;
-    virtual void websocket_received(i64 websocket_id, bool, ByteBuffer) override;
+    virtual void websocket_received(i64 websocket_id, bool, IPC::LargeBytes) override;
     virtual void websocket_errored(i64 websocket_id, i32) override;
     virtual void websocket_closed(i64 websocket_id, u16, ByteString, bool) override;
     virtual void websocket_ready_state_changed(i64 websocket_id, u32 ready_state) override;
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Assertions.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Types.h>
+#include <LibRequests/ALPNHttpVersion.h>
+
+namespace Requests {
+
+// The order in which responses should be delivered when requests compete for bandwidth, e.g. render-blocking style
+// sheets before images that are outside of the viewport.
+enum class RequestPriority : u8 {
+    Lowest,
+    Low,
+    Medium,
+    High,
+    Highest,
+};
+
+// NOTE: Priorities are received over IPC, so they must be validated before they are used.
+constexpr bool is_valid_request_priority(RequestPriority priority)
+{
+    return to_underlying(priority) <= to_underlying(RequestPriority::Highest);
+}
+
+constexpr RequestPriority raise_request_priority(RequestPriority priority)
+{
+    if (priority == RequestPriority::Highest)
+        return priority;
+    return static_cast<RequestPriority>(to_underlying(priority) + 1);
+}
+
+constexpr RequestPriority lower_request_priority(RequestPriority priority)
+{
+    if (priority == RequestPriority::Lowest)
+        return priority;
+    return static_cast<RequestPriority>(to_underlying(priority) - 1);
+}
+
+// The weight of an HTTP/2 stream, between 1 and 256. See: https://www.rfc-editor.org/rfc/rfc7540#section-5.3.2
+constexpr long request_priority_to_http2_stream_weight(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Lowest:
+        return 110;
+    case RequestPriority::Low:
+        return 147;
+    case RequestPriority::Medium:
+        return 183;
+    case RequestPriority::High:
+        return 220;
+    case RequestPriority::Highest:
+        return 256;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// The urgency parameter of the HTTP Priority header, between 0 (most urgent) and 7. This is used for HTTP/2 and HTTP/3
+// servers which support extensible priorities. See: https://www.rfc-editor.org/rfc/rfc9218#section-4.1
+constexpr u8 request_priority_to_urgency(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Lowest:
+        return 5;
+    case RequestPriority::Low:
+        return 4;
+    case RequestPriority::Medium:
+        // NOTE: This is the default urgency, which servers assume if the Priority header is absent.
+        return 3;
+    case RequestPriority::High:
+        return 1;
+    case RequestPriority::Highest:
+        return 0;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Whether the urgency of a request should be sent in a Priority header, given the HTTP version of the last response from
+// the same origin. HTTP/1.1 servers don't multiplex requests over a connection, so the header would only be overhead.
+constexpr bool should_send_priority_header(RequestPriority priority, ALPNHttpVersion http_version)
+{
+    // NOTE: Servers assume the default urgency if the header is absent.
+    if (priority == RequestPriority::Medium)
+        return false;
+
+    switch (http_version) {
+    case ALPNHttpVersion::Http2_TLS:
+    case ALPNHttpVersion::Http2_TCP:
+    case ALPNHttpVersion::Http3:
+        return true;
+    case ALPNHttpVersion::None:
+    case ALPNHttpVersion::Http1_0:
+    case ALPNHttpVersion::Http1_1:
+        return false;
+    }
+    return false;
+}
+
+}
@@ -37,6 +37,10 @@ WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::construct_imp
             return TRY(Compress::DeflateCompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::Gzip:
             return TRY(Compress::GzipCompressor::create(move(input_stream)));
+        case Bindings::CompressionFormat::Brotli:
+        case Bindings::CompressionFormat::Zstd:
+            // FIXME: Support compressing brotli and zstd. We currently only support decoding them.
+            return Error::from_string_literal("Compression format is not supported");
         }
 
         VERIFY_NOT_REACHED();
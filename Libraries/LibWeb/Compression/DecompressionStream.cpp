@@ -5,9 +5,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCompress/Brotli.h>
 #include <LibCompress/Deflate.h>
 #include <LibCompress/Gzip.h>
 #include <LibCompress/Zlib.h>
+#include <LibCompress/Zstd.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/TypedArray.h>
@@ -37,6 +39,10 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct
             return TRY(Compress::DeflateDecompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::Gzip:
             return TRY(Compress::GzipDecompressor::create((move(input_stream))));
+        case Bindings::CompressionFormat::Brotli:
+            return TRY(Compress::BrotliDecompressor::create(move(input_stream)));
+        case Bindings::CompressionFormat::Zstd:
+            return TRY(Compress::ZstdDecompressor::create(move(input_stream)));
         }
 
         VERIFY_NOT_REACHED();
@@ -150,6 +156,8 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue()
 
     // 1. Let buffer be the result of decompressing an empty input with ds's format and context, with the finish flag.
     auto maybe_buffer = m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
+        if constexpr (requires { decompressor->did_receive_all_input(); })
+            decompressor->did_receive_all_input();
         return TRY(decompressor->read_until_eof());
     });
     if (maybe_buffer.is_error())
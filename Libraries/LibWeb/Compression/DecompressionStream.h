@@ -22,7 +22,9 @@ namespace Web::Compression {
 using Decompressor = Variant<
     NonnullOwnPtr<Compress::ZlibDecompressor>,
     NonnullOwnPtr<Compress::DeflateDecompressor>,
-    NonnullOwnPtr<Compress::GzipDecompressor>>;
+    NonnullOwnPtr<Compress::GzipDecompressor>,
+    NonnullOwnPtr<Compress::BrotliDecompressor>,
+    NonnullOwnPtr<Compress::ZstdDecompressor>>;
 
 // https://compression.spec.whatwg.org/#decompressionstream
 class DecompressionStream final
@@ -20,6 +20,7 @@
 #include <AK/Utf8View.h>
 #include <LibCore/DateTime.h>
 #include <LibCore/Timer.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/RootVector.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/FunctionObject.h>
@@ -1303,6 +1304,8 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (m_created_for_appropriate_template_contents)
         return;
 
+    Core::ScopedTraceEvent trace_event { "layout"sv, "Document::update_layout"sv };
+
     // Clear text blocks cache so we rebuild them on the next find action.
     if (m_layout_root)
         m_layout_root->invalidate_text_blocks_cache();
@@ -1512,6 +1515,8 @@ void Document::update_style()
     if (!m_style_invalidator->has_pending_invalidations() && !needs_full_style_update() && !needs_style_update() && !child_needs_style_update())
         return;
 
+    Core::ScopedTraceEvent trace_event { "style"sv, "Document::update_style"sv };
+
     m_style_invalidator->invalidate(*this);
 
     // NOTE: If this is a document hosting <template> contents, style update is unnecessary.
@@ -6416,6 +6421,8 @@ RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig co
         return m_cached_display_list;
     }
 
+    Core::ScopedTraceEvent trace_event { "paint"sv, "Document::record_display_list"sv };
+
     auto display_list = Painting::DisplayList::create(page().client().device_pixels_per_css_pixel());
     Painting::DisplayListRecorder display_list_recorder(display_list);
 
@@ -11,6 +11,7 @@
 #include <LibWeb/Fetch/Infrastructure/Task.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Streams/ReadableStream.h>
 #include <LibWeb/WebIDL/Promise.h>
 
@@ -18,9 +19,14 @@ namespace Web::Fetch::Fetching {
 
 GC_DEFINE_ALLOCATOR(FetchedDataReceiver);
 
-FetchedDataReceiver::FetchedDataReceiver(GC::Ref<Infrastructure::FetchParams const> fetch_params, GC::Ref<Streams::ReadableStream> stream)
+// The limits on the size of buffer, beyond which the ongoing fetch is suspended until the stream has caught up.
+static constexpr size_t buffer_size_to_suspend_fetch = 4 * MiB;
+static constexpr size_t buffer_size_to_resume_fetch = 1 * MiB;
+
+FetchedDataReceiver::FetchedDataReceiver(GC::Ref<Infrastructure::FetchParams const> fetch_params, GC::Ref<Streams::ReadableStream> stream, int load_request_id)
     : m_fetch_params(fetch_params)
     , m_stream(stream)
+    , m_load_request_id(load_request_id)
 {
 }
 
@@ -34,55 +40,96 @@ void FetchedDataReceiver::visit_edges(Visitor& visitor)
     visitor.visit(m_pending_promise);
 }
 
+// This implements the parallel steps of the pullAlgorithm in HTTP-network-fetch.
+// https://fetch.spec.whatwg.org/#ref-for-in-parallel④
 void FetchedDataReceiver::set_pending_promise(GC::Ref<WebIDL::Promise> promise)
 {
-    auto had_pending_promise = m_pending_promise != nullptr;
     m_pending_promise = promise;
 
-    if (!had_pending_promise && !m_buffer.is_empty()) {
-        on_data_received(m_buffer);
-        m_buffer.clear();
+    // 1. If the size of buffer is smaller than a lower limit chosen by the user agent and the ongoing fetch is
+    //    suspended, resume the fetch.
+    if (m_fetch_is_suspended && m_buffer.size() < buffer_size_to_resume_fetch) {
+        m_fetch_is_suspended = false;
+        ResourceLoader::the().resume_request(m_load_request_id);
     }
+
+    // 2. Wait until buffer is not empty.
+    // NOTE: If it is empty, we continue in on_data_received once more bytes have been transmitted.
+    if (!m_buffer.is_empty())
+        pull_bytes_into_stream();
 }
 
-// This implements the parallel steps of the pullAlgorithm in HTTP-network-fetch.
-// https://fetch.spec.whatwg.org/#ref-for-in-parallel④
+// This implements steps 7 and 8 of the parallel steps of HTTP-network-fetch, for bytes transmitted from the response's
+// message body.
 void FetchedDataReceiver::on_data_received(ReadonlyBytes bytes)
 {
-    // FIXME: 1. If the size of buffer is smaller than a lower limit chosen by the user agent and the ongoing fetch
-    //           is suspended, resume the fetch.
-    // FIXME: 2. Wait until buffer is not empty.
-
-    // If the remote end sends data immediately after we receive headers, we will often get that data here before the
-    // stream tasks have all been queued internally. Just hold onto that data.
-    if (!m_pending_promise) {
-        m_buffer.append(bytes);
-        return;
+    // 7. Append bytes to buffer.
+    m_buffer.append(bytes);
+
+    // 8. If the size of buffer is larger than an upper limit chosen by the user agent, ask the user agent to suspend
+    //    the ongoing fetch.
+    if (!m_fetch_is_suspended && m_buffer.size() > buffer_size_to_suspend_fetch) {
+        m_fetch_is_suspended = true;
+        ResourceLoader::the().suspend_request(m_load_request_id);
     }
 
+    if (m_pending_promise)
+        pull_bytes_into_stream();
+}
+
+void FetchedDataReceiver::on_data_complete()
+{
+    m_all_data_received = true;
+
+    // NOTE: The bytes that are still in buffer will be pulled into the stream before it is closed.
+    if (!m_buffer.is_empty())
+        return;
+
+    // Otherwise, if the bytes transmission for response’s message body is done normally and stream is readable, then
+    // close stream, and abort these in-parallel steps.
+    if (m_stream->is_readable())
+        m_stream->close();
+
+    if (auto promise = exchange(m_pending_promise, nullptr))
+        WebIDL::resolve_promise(m_stream->realm(), *promise, JS::js_undefined());
+}
+
+void FetchedDataReceiver::pull_bytes_into_stream()
+{
+    auto promise = exchange(m_pending_promise, nullptr);
+    VERIFY(promise);
+
     // 3. Queue a fetch task to run the following steps, with fetchParams’s task destination.
+    // NOTE: Bytes that are transmitted before this task runs are pulled into the stream along with the ones we have now.
     Infrastructure::queue_fetch_task(
         m_fetch_params->controller(),
         m_fetch_params->task_destination(),
-        GC::create_function(heap(), [this, bytes = MUST(ByteBuffer::copy(bytes))]() mutable {
+        GC::create_function(heap(), [this, promise = GC::Ref { *promise }]() {
             HTML::TemporaryExecutionContext execution_context { m_stream->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
             // 1. Pull from bytes buffer into stream.
-            if (auto result = m_stream->pull_from_bytes(move(bytes)); result.is_error()) {
-                auto throw_completion = Bindings::exception_to_throw_completion(m_stream->vm(), result.release_error());
+            if (m_stream->is_readable() && !m_buffer.is_empty()) {
+                if (auto result = m_stream->pull_from_bytes(m_buffer); result.is_error()) {
+                    auto throw_completion = Bindings::exception_to_throw_completion(m_stream->vm(), result.release_error());
 
-                dbgln("FetchedDataReceiver: Stream error pulling bytes");
-                HTML::report_exception(throw_completion, m_stream->realm());
+                    dbgln("FetchedDataReceiver: Stream error pulling bytes");
+                    HTML::report_exception(throw_completion, m_stream->realm());
 
-                return;
+                    return;
+                }
             }
 
             // 2. If stream is errored, then terminate fetchParams’s controller.
             if (m_stream->is_errored())
                 m_fetch_params->controller()->terminate();
 
+            // NOTE: If the transmission of the response's message body was done before buffer was emptied, we close
+            //       the stream now.
+            if (m_all_data_received && m_buffer.is_empty() && m_stream->is_readable())
+                m_stream->close();
+
             // 3. Resolve promise with undefined.
-            WebIDL::resolve_promise(m_stream->realm(), *m_pending_promise, JS::js_undefined());
+            WebIDL::resolve_promise(m_stream->realm(), *promise, JS::js_undefined());
         }));
 }
 
@@ -22,16 +22,23 @@ public:
 
     void set_pending_promise(GC::Ref<WebIDL::Promise>);
     void on_data_received(ReadonlyBytes);
+    void on_data_complete();
 
 private:
-    FetchedDataReceiver(GC::Ref<Infrastructure::FetchParams const>, GC::Ref<Streams::ReadableStream>);
+    FetchedDataReceiver(GC::Ref<Infrastructure::FetchParams const>, GC::Ref<Streams::ReadableStream>, int load_request_id);
 
     virtual void visit_edges(Visitor& visitor) override;
 
+    void pull_bytes_into_stream();
+
     GC::Ref<Infrastructure::FetchParams const> m_fetch_params;
     GC::Ref<Streams::ReadableStream> m_stream;
     GC::Ptr<WebIDL::Promise> m_pending_promise;
     ByteBuffer m_buffer;
+
+    int m_load_request_id { -1 };
+    bool m_fetch_is_suspended { false };
+    bool m_all_data_received { false };
 };
 
 }
@@ -13,6 +13,7 @@
 #include <AK/ScopeGuard.h>
 #include <LibJS/Runtime/Completion.h>
 #include <LibRequests/RequestTimingInfo.h>
+#include <LibURL/Site.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
@@ -66,6 +67,7 @@
 namespace Web::Fetch::Fetching {
 
 bool g_http_cache_enabled;
+bool g_response_streaming_enabled;
 
 #define TRY_OR_IGNORE(expression)                                                                    \
     ({                                                                                               \
@@ -77,6 +79,56 @@ bool g_http_cache_enabled;
         _temporary_result.release_value();                                                           \
     })
 
+static Requests::RequestPriority internal_priority_for_request(Infrastructure::Request const& request)
+{
+    using enum Requests::RequestPriority;
+
+    // NOTE: Documents and style sheets block rendering, and images are given a low priority as they tend to be outside
+    //       of the viewport. Images which do turn out to be visible are boosted once they have been laid out.
+    auto priority = Medium;
+
+    if (request.destination().has_value()) {
+        switch (*request.destination()) {
+        case Infrastructure::Request::Destination::Document:
+        case Infrastructure::Request::Destination::Frame:
+        case Infrastructure::Request::Destination::IFrame:
+        case Infrastructure::Request::Destination::Style:
+            priority = Highest;
+            break;
+        case Infrastructure::Request::Destination::Font:
+            priority = High;
+            break;
+        case Infrastructure::Request::Destination::Audio:
+        case Infrastructure::Request::Destination::Image:
+        case Infrastructure::Request::Destination::Track:
+        case Infrastructure::Request::Destination::Video:
+            priority = Low;
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (request.initiator() == Infrastructure::Request::Initiator::Prefetch)
+        priority = Lowest;
+
+    if (request.render_blocking())
+        priority = max(priority, High);
+
+    switch (request.priority()) {
+    case Infrastructure::Request::Priority::High:
+        priority = Requests::raise_request_priority(priority);
+        break;
+    case Infrastructure::Request::Priority::Low:
+        priority = Requests::lower_request_priority(priority);
+        break;
+    case Infrastructure::Request::Priority::Auto:
+        break;
+    }
+
+    return priority;
+}
+
 // https://fetch.spec.whatwg.org/#concept-fetch
 WebIDL::ExceptionOr<GC::Ref<Infrastructure::FetchController>> fetch(JS::Realm& realm, Infrastructure::Request& request, Infrastructure::FetchAlgorithms const& algorithms, UseParallelQueue use_parallel_queue)
 {
@@ -253,6 +305,8 @@ WebIDL::ExceptionOr<GC::Ref<Infrastructure::FetchController>> fetch(JS::Realm& r
     //     in setting request’s priority to a user-agent-defined object.
     // NOTE: The user-agent-defined object could encompass stream weight and dependency for HTTP/2, and equivalent
     //       information used to prioritize dispatch and processing of HTTP/1 fetches.
+    if (!request.internal_priority().has_value())
+        request.set_internal_priority(Infrastructure::Request::InternalPriority { internal_priority_for_request(request) });
 
     // 16. If request is a subresource request, then:
     if (request.is_subresource_request()) {
@@ -2293,6 +2347,22 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
 
+    if (request->internal_priority().has_value())
+        load_request.set_priority(request->internal_priority()->priority);
+
+    // AD-HOC: Compression dictionaries are partitioned like the HTTP cache, and must not be used for responses that
+    //         would be opaque to us.
+    //         https://www.rfc-editor.org/rfc/rfc9842#name-security-considerations
+    if (request->response_tainting() != Infrastructure::Request::ResponseTainting::Opaque) {
+        if (auto partition_key = Infrastructure::determine_the_network_partition_key(*request); partition_key.has_value() && !partition_key->top_level_origin.is_opaque())
+            load_request.set_compression_dictionary_partition(URL::Site::obtain(partition_key->top_level_origin).serialize());
+    }
+
+    // AD-HOC: Let the fetch controller's owner change the priority of the request while it is in flight.
+    fetch_params.controller()->set_change_priority_steps([load_request_id = load_request.id()](Requests::RequestPriority priority) {
+        ResourceLoader::the().set_request_priority(load_request_id, priority);
+    });
+
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
 
@@ -2318,16 +2388,25 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
         log_load_request(load_request);
     }
 
-    // FIXME: This check should be removed and all HTTP requests should go through the `ResourceLoader::load_unbuffered`
-    //        path. The buffer option should then be supplied to the steps below that allow us to buffer data up to a
-    //        user-agent-defined limit (or not). However, we will need to fully use stream operations throughout the
-    //        fetch process to enable this (e.g. Body::fully_read must use streams for this to work).
-    if (request->buffer_policy() == Infrastructure::Request::BufferPolicy::DoNotBufferResponse) {
+    // NOTE: With response streaming enabled, HTTP(S) response bodies are streamed into the response's body as they
+    //       are received, rather than being buffered in their entirety first. This lets consumers start on a response
+    //       before it has been fully received, and bounds how much of it we hold in memory when they are slower than
+    //       the network.
+    // FIXME: Navigation responses are still buffered, as loading a document sniffs its MIME type from the response
+    //        body's source. So is everything while the HTTP cache is enabled, as it only stores responses whose body
+    //        is a byte sequence.
+    auto should_stream_response = request->buffer_policy() == Infrastructure::Request::BufferPolicy::DoNotBufferResponse
+        || (g_response_streaming_enabled
+            && Infrastructure::is_http_or_https_scheme(request->current_url().scheme())
+            && !request->is_navigation_request()
+            && !g_http_cache_enabled);
+
+    if (should_stream_response) {
         HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
         // 12. Let stream be a new ReadableStream.
         auto stream = realm.create<Streams::ReadableStream>(realm);
-        auto fetched_data_receiver = realm.create<FetchedDataReceiver>(fetch_params, stream);
+        auto fetched_data_receiver = realm.create<FetchedDataReceiver>(fetch_params, stream, load_request.id());
 
         // 10. Let pullAlgorithm be the followings steps:
         auto pull_algorithm = GC::create_function(realm.heap(), [&realm, fetched_data_receiver]() {
@@ -2343,8 +2422,13 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
         });
 
         // 11. Let cancelAlgorithm be an algorithm that aborts fetchParams’s controller with reason, given reason.
-        auto cancel_algorithm = GC::create_function(realm.heap(), [&realm, &fetch_params](JS::Value reason) {
+        auto cancel_algorithm = GC::create_function(realm.heap(), [&realm, &fetch_params, load_request_id = load_request.id()](JS::Value reason) {
             fetch_params.controller()->abort(realm, reason);
+
+            // NOTE: Nothing is going to read the rest of the response, so stop receiving it. This also keeps a fetch that
+            //       was suspended, because its stream wasn't being read, from holding on to its connection.
+            ResourceLoader::the().stop_request(load_request_id);
+
             return WebIDL::create_resolved_promise(realm, JS::js_undefined());
         });
 
@@ -2400,22 +2484,23 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
                 // FIXME: 6. If bytes is failure, then terminate fetchParams’s controller.
 
                 // 7. Append bytes to buffer.
+                // 8. If the size of buffer is larger than an upper limit chosen by the user agent, ask the user agent
+                //    to suspend the ongoing fetch.
+                // NOTE: These are handled by FetchedDataReceiver.
                 fetched_data_receiver->on_data_received(bytes);
-
-                // FIXME: 8. If the size of buffer is larger than an upper limit chosen by the user agent, ask the user agent
-                //           to suspend the ongoing fetch.
             }
         });
 
-        auto on_complete = GC::create_function(vm.heap(), [&vm, &realm, pending_response, stream](bool success, Requests::RequestTimingInfo const&, Optional<StringView> error_message) {
-            dbgln("FIXME: Implement on_complete timing info for unbuffered requests");
+        auto on_complete = GC::create_function(vm.heap(), [&vm, &realm, pending_response, stream, fetched_data_receiver, fetch_timing_info, cross_origin_isolated_capability](bool success, Requests::RequestTimingInfo const& timing_info, Optional<StringView> error_message) {
             HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
+            fetch_timing_info->update_final_timings(timing_info, cross_origin_isolated_capability);
+
             // 16.1.1.2. Otherwise, if the bytes transmission for response’s message body is done normally and stream is readable,
             //           then close stream, and abort these in-parallel steps.
+            // NOTE: FetchedDataReceiver closes the stream once the bytes it has buffered have been pulled into it.
             if (success) {
-                if (stream->is_readable())
-                    stream->close();
+                fetched_data_receiver->on_data_complete();
             }
             // 16.1.2.2. Otherwise, if stream is readable, error stream with a TypeError.
             else {
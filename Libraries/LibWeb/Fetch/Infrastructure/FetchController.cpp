@@ -9,6 +9,7 @@
 #include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Infrastructure/FetchParams.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/WebIDL/DOMException.h>
@@ -30,6 +31,7 @@ void FetchController::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_full_timing_info);
     visitor.visit(m_report_timing_steps);
     visitor.visit(m_next_manual_redirect_steps);
+    visitor.visit(m_change_priority_steps);
     visitor.visit(m_fetch_params);
 }
 
@@ -43,6 +45,11 @@ void FetchController::set_next_manual_redirect_steps(Function<void()> next_manua
     m_next_manual_redirect_steps = GC::create_function(vm().heap(), move(next_manual_redirect_steps));
 }
 
+void FetchController::set_change_priority_steps(Function<void(Requests::RequestPriority)> change_priority_steps)
+{
+    m_change_priority_steps = GC::create_function(vm().heap(), move(change_priority_steps));
+}
+
 // https://fetch.spec.whatwg.org/#finalize-and-report-timing
 void FetchController::report_timing(JS::Object& global) const
 {
@@ -63,6 +70,22 @@ void FetchController::process_next_manual_redirect() const
     m_next_manual_redirect_steps->function()();
 }
 
+void FetchController::set_priority(Requests::RequestPriority priority)
+{
+    if (m_state != State::Ongoing || !m_fetch_params)
+        return;
+
+    auto request = m_fetch_params->request();
+    if (request->internal_priority().has_value() && request->internal_priority()->priority == priority)
+        return;
+
+    // NOTE: The request's internal priority is updated as well, so that the new priority also applies after redirects.
+    request->set_internal_priority(Request::InternalPriority { priority });
+
+    if (m_change_priority_steps)
+        m_change_priority_steps->function()(priority);
+}
+
 // https://fetch.spec.whatwg.org/#extract-full-timing-info
 GC::Ref<FetchTimingInfo> FetchController::extract_full_timing_info() const
 {
@@ -13,6 +13,7 @@
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Runtime/VM.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibWeb/Fetch/Infrastructure/FetchTimingInfo.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
@@ -37,11 +38,13 @@ public:
     void set_full_timing_info(GC::Ref<FetchTimingInfo> full_timing_info) { m_full_timing_info = full_timing_info; }
     void set_report_timing_steps(Function<void(JS::Object&)> report_timing_steps);
     void set_next_manual_redirect_steps(Function<void()> next_manual_redirect_steps);
+    void set_change_priority_steps(Function<void(Requests::RequestPriority)> change_priority_steps);
 
     [[nodiscard]] State state() const { return m_state; }
 
     void report_timing(JS::Object&) const;
     void process_next_manual_redirect() const;
+    void set_priority(Requests::RequestPriority);
     [[nodiscard]] GC::Ref<FetchTimingInfo> extract_full_timing_info() const;
     void abort(JS::Realm&, Optional<JS::Value>);
     JS::Value deserialize_a_serialized_abort_reason(JS::Realm&);
@@ -85,6 +88,9 @@ private:
     //     Null or an algorithm accepting nothing.
     GC::Ptr<GC::Function<void()>> m_next_manual_redirect_steps;
 
+    // AD-HOC: Changes the priority of the request that is currently in flight for this fetch, if any.
+    GC::Ptr<GC::Function<void(Requests::RequestPriority)>> m_change_priority_steps;
+
     GC::Ptr<FetchParams> m_fetch_params;
 
     HashMap<u64, HTML::TaskID> m_ongoing_fetch_tasks;
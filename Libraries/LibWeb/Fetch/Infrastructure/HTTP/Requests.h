@@ -17,6 +17,7 @@
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibURL/Origin.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
@@ -167,7 +168,9 @@ public:
     };
 
     // Members are implementation-defined
-    struct InternalPriority { };
+    struct InternalPriority {
+        Requests::RequestPriority priority { Requests::RequestPriority::Medium };
+    };
 
     using BodyType = Variant<Empty, ByteBuffer, GC::Ref<Body>>;
     using OriginType = Variant<Origin, URL::Origin>;
@@ -226,6 +229,9 @@ public:
     [[nodiscard]] Priority const& priority() const { return m_priority; }
     void set_priority(Priority priority) { m_priority = priority; }
 
+    [[nodiscard]] Optional<InternalPriority> const& internal_priority() const { return m_internal_priority; }
+    void set_internal_priority(Optional<InternalPriority> internal_priority) { m_internal_priority = move(internal_priority); }
+
     [[nodiscard]] OriginType const& origin() const { return m_origin; }
     void set_origin(OriginType origin) { m_origin = move(origin); }
 
@@ -6,6 +6,8 @@
  */
 
 #include <LibCore/EventLoop.h>
+#include <LibCore/Tracing.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/FontFaceSet.h>
@@ -54,6 +56,7 @@ void EventLoop::visit_edges(Visitor& visitor)
     visitor.visit(m_backup_incumbent_realm_stack);
     visitor.visit(m_rendering_task_function);
     visitor.visit(m_system_event_loop_timer);
+    visitor.visit(m_program_cache_expiry_timer);
 }
 
 void EventLoop::schedule()
@@ -68,6 +71,24 @@ void EventLoop::schedule()
         m_system_event_loop_timer->restart();
 }
 
+// Once nothing uses the cached programs anymore, nothing else would evict them either, so we check for idle entries
+// periodically for as long as there are any.
+void EventLoop::schedule_program_cache_expiry()
+{
+    if (vm().program_cache().is_empty())
+        return;
+
+    if (!m_program_cache_expiry_timer) {
+        m_program_cache_expiry_timer = Platform::Timer::create_single_shot(heap(), JS::ProgramCache::maximum_idle_time.to_milliseconds(), GC::create_function(heap(), [this] {
+            vm().program_cache().evict_idle_entries();
+            schedule_program_cache_expiry();
+        }));
+    }
+
+    if (!m_program_cache_expiry_timer->is_active())
+        m_program_cache_expiry_timer->restart();
+}
+
 EventLoop& main_thread_event_loop()
 {
     return *static_cast<HTML::Agent*>(Bindings::main_thread_vm().agent())->event_loop;
@@ -179,7 +200,10 @@ void EventLoop::process()
         m_currently_running_task = oldest_task.ptr();
 
         // 6. Perform oldestTask's steps.
-        oldest_task->execute();
+        {
+            Core::ScopedTraceEvent trace_event { "event-loop"sv, "EventLoop::run_task"sv };
+            oldest_task->execute();
+        }
 
         // 7. Set the event loop's currently running task back to null.
         m_currently_running_task = nullptr;
@@ -216,6 +240,8 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        schedule_program_cache_expiry();
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
@@ -320,6 +346,8 @@ void EventLoop::update_the_rendering()
         m_running_rendering_task = false;
     };
 
+    Core::ScopedTraceEvent trace_event { "event-loop"sv, "EventLoop::update_the_rendering"sv };
+
     process_input_events();
 
     // 1. Let frameTimestamp be eventLoop's last render opportunity time.
@@ -576,6 +604,8 @@ void EventLoop::perform_a_microtask_checkpoint()
     // 2. Set the event loop's performing a microtask checkpoint to true.
     m_performing_a_microtask_checkpoint = true;
 
+    Core::ScopedTraceEvent trace_event { "event-loop"sv, "EventLoop::perform_a_microtask_checkpoint"sv };
+
     // 3. While the event loop's microtask queue is not empty:
     while (!m_microtask_queue->is_empty()) {
         // 1. Let oldestMicrotask be the result of dequeuing from the event loop's microtask queue.
@@ -100,6 +100,8 @@ private:
     void process_input_events() const;
     void update_the_rendering();
 
+    void schedule_program_cache_expiry();
+
     Type m_type { Type::Window };
 
     GC::Ptr<TaskQueue> m_task_queue;
@@ -114,6 +116,7 @@ private:
     double m_last_idle_period_start_time { 0 };
 
     GC::Ptr<Platform::Timer> m_system_event_loop_timer;
+    GC::Ptr<Platform::Timer> m_program_cache_expiry_timer;
 
     // https://html.spec.whatwg.org/multipage/webappapis.html#performing-a-microtask-checkpoint
     bool m_performing_a_microtask_checkpoint { false };
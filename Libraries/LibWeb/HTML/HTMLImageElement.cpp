@@ -205,8 +205,17 @@ RefPtr<Gfx::ImmutableBitmap> HTMLImageElement::current_image_bitmap(Gfx::IntSize
     return nullptr;
 }
 
-void HTMLImageElement::set_visible_in_viewport(bool)
+void HTMLImageElement::set_visible_in_viewport(bool visible_in_viewport)
 {
+    // NOTE: Images are fetched with a low priority, as most of them tend to be outside of the viewport. Once an image
+    //       that is still being fetched turns out to be visible, let it overtake those that are not, unless the
+    //       author explicitly asked for it to be fetched with a low priority.
+    if (visible_in_viewport && m_current_request->is_fetching()) {
+        auto fetch_priority = Fetch::Infrastructure::request_priority_from_string(get_attribute_value(HTML::AttributeNames::fetchpriority));
+        if (fetch_priority != Fetch::Infrastructure::Request::Priority::Low)
+            m_current_request->set_fetch_priority(Requests::RequestPriority::High);
+    }
+
     // FIXME: Loosen grip on image data when it's not visible, e.g via volatile memory.
 }
 
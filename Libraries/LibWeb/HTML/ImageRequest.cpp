@@ -127,6 +127,12 @@ void ImageRequest::fetch_image(JS::Realm& realm, GC::Ref<Fetch::Infrastructure::
     m_shared_resource_request->fetch_resource(realm, request);
 }
 
+void ImageRequest::set_fetch_priority(Requests::RequestPriority priority)
+{
+    if (m_shared_resource_request)
+        m_shared_resource_request->set_fetch_priority(priority);
+}
+
 void ImageRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
 {
     VERIFY(m_shared_resource_request);
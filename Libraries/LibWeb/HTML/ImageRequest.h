@@ -10,6 +10,7 @@
 #include <AK/OwnPtr.h>
 #include <LibGC/Root.h>
 #include <LibGfx/Size.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
 
@@ -55,6 +56,7 @@ public:
     void prepare_for_presentation(HTMLImageElement&);
 
     void fetch_image(JS::Realm&, GC::Ref<Fetch::Infrastructure::Request>);
+    void set_fetch_priority(Requests::RequestPriority);
     void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
 
     GC::Ptr<SharedResourceRequest const> shared_resource_request() const { return m_shared_resource_request; }
@@ -116,6 +116,12 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
     set_fetch_controller(fetch_controller);
 }
 
+void SharedResourceRequest::set_fetch_priority(Requests::RequestPriority priority)
+{
+    if (m_state == State::Fetching && m_fetch_controller)
+        m_fetch_controller->set_priority(priority);
+}
+
 void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
 {
     if (m_state == State::Finished) {
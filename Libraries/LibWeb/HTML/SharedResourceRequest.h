@@ -11,6 +11,7 @@
 #include <LibGC/Function.h>
 #include <LibGC/Root.h>
 #include <LibGfx/Size.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
 
@@ -33,6 +34,7 @@ public:
     void set_fetch_controller(GC::Ptr<Fetch::Infrastructure::FetchController>);
 
     void fetch_resource(JS::Realm&, GC::Ref<Fetch::Infrastructure::Request>);
+    void set_fetch_priority(Requests::RequestPriority);
 
     void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
 
@@ -1558,11 +1558,10 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
             auto const& inner_record = record.get<IndexRecord>();
 
             // * The record’s key is equal to key and the record’s value is greater than or equal to primaryKey
-            if (!(Key::equals(inner_record.key, *key) && (Key::greater_than(inner_record.value, *primary_key) || Key::equals(inner_record.value, *primary_key))))
-                return false;
+            auto is_at_or_after_primary_key = Key::equals(inner_record.key, *key) && (Key::greater_than(inner_record.value, *primary_key) || Key::equals(inner_record.value, *primary_key));
 
-            // * The record’s key is greater than key.
-            if (!Key::greater_than(inner_record.key, *key))
+            // * Or, the record’s key is greater than key.
+            if (!is_at_or_after_primary_key && !Key::greater_than(inner_record.key, *key))
                 return false;
         }
 
@@ -1580,11 +1579,10 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
             auto const& inner_record = record.get<IndexRecord>();
 
             // * The record’s key is equal to position and the record’s value is greater than object store position
-            if (!(Key::equals(inner_record.key, *position) && (Key::greater_than(inner_record.value, *object_store_position))))
-                return false;
+            auto is_after_object_store_position = Key::equals(inner_record.key, *position) && Key::greater_than(inner_record.value, *object_store_position);
 
-            // * The record’s key is greater than position.
-            if (!Key::greater_than(inner_record.key, *position))
+            // * Or, the record’s key is greater than position.
+            if (!is_after_object_store_position && !Key::greater_than(inner_record.key, *position))
                 return false;
         }
 
@@ -1618,7 +1616,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
             auto is_greater_than_position = record.visit(
                 [](Empty) { VERIFY_NOT_REACHED(); },
                 [position](auto const& inner_record) {
-                    return Key::greater_than(inner_record.key, *position) || Key::equals(inner_record.key, *position);
+                    return Key::greater_than(inner_record.key, *position);
                 });
 
             if (!is_greater_than_position)
@@ -1654,11 +1652,10 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
             auto const& inner_record = record.get<IndexRecord>();
 
             // * The record’s key is equal to key and the record’s value is less than or equal to primaryKey
-            if (!(Key::equals(inner_record.key, *key) && (Key::less_than(inner_record.value, *primary_key) || Key::equals(inner_record.value, *primary_key))))
-                return false;
+            auto is_at_or_before_primary_key = Key::equals(inner_record.key, *key) && (Key::less_than(inner_record.value, *primary_key) || Key::equals(inner_record.value, *primary_key));
 
-            // * The record’s key is less than key.
-            if (!Key::less_than(inner_record.key, *key))
+            // * Or, the record’s key is less than key.
+            if (!is_at_or_before_primary_key && !Key::less_than(inner_record.key, *key))
                 return false;
         }
 
@@ -1676,11 +1673,10 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
             auto const& inner_record = record.get<IndexRecord>();
 
             // * The record’s key is equal to position and the record’s value is less than object store position
-            if (!(Key::equals(inner_record.key, *position) && Key::less_than(inner_record.value, *object_store_position)))
-                return false;
+            auto is_before_object_store_position = Key::equals(inner_record.key, *position) && Key::less_than(inner_record.value, *object_store_position);
 
-            // * The record’s key is less than position.
-            if (!Key::less_than(inner_record.key, *position))
+            // * Or, the record’s key is less than position.
+            if (!is_before_object_store_position && !Key::less_than(inner_record.key, *position))
                 return false;
         }
 
@@ -1714,7 +1710,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
             auto is_less_than_position = record.visit(
                 [](Empty) { VERIFY_NOT_REACHED(); },
                 [position](auto const& inner_record) {
-                    return Key::less_than(inner_record.key, *position) || Key::equals(inner_record.key, *position);
+                    return Key::less_than(inner_record.key, *position);
                 });
 
             if (!is_less_than_position)
@@ -1731,6 +1727,33 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         return is_in_range;
     };
 
+    // OPTIMIZATION: Records are sorted by key, so rather than testing every record against the requirements above, we
+    //               skip straight past the records whose key is below (or, going backwards, above) all of the keys
+    //               that the requirements compare against.
+    auto records_not_below_keys = [&](auto content) {
+        GC::Ptr<Key> lower_bound = range->lower_key();
+        for (GC::Ptr<Key> candidate : { key, position }) {
+            if (candidate && (!lower_bound || Key::greater_than(*candidate, *lower_bound)))
+                lower_bound = candidate;
+        }
+
+        if (!lower_bound)
+            return content;
+        return content.slice(index_of_first_record_after(content, *lower_bound, KeyBound::Inclusive));
+    };
+
+    auto records_not_above_keys = [&](auto content) {
+        GC::Ptr<Key> upper_bound = range->upper_key();
+        for (GC::Ptr<Key> candidate : { key, position }) {
+            if (candidate && (!upper_bound || Key::less_than(*candidate, *upper_bound)))
+                upper_bound = candidate;
+        }
+
+        if (!upper_bound)
+            return content;
+        return content.trim(index_of_first_record_after(content, *upper_bound, KeyBound::Exclusive));
+    };
+
     // 9. While count is greater than 0:
     Variant<Empty, Record, IndexRecord> found_record;
     while (count > 0) {
@@ -1739,7 +1762,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Next: {
             // Let found record be the first record in records which satisfy all of the following requirements:
             found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.first_matching(next_requirements);
+                auto value = records_not_below_keys(content).first_matching(next_requirements);
                 if (value.has_value())
                     return *value;
 
@@ -1750,7 +1773,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Nextunique: {
             // Let found record be the first record in records which satisfy all of the following requirements:
             found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.first_matching(next_unique_requirements);
+                auto value = records_not_below_keys(content).first_matching(next_unique_requirements);
                 if (value.has_value())
                     return *value;
 
@@ -1761,7 +1784,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Prev: {
             // Let found record be the last record in records which satisfy all of the following requirements:
             found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.last_matching(prev_requirements);
+                auto value = records_not_above_keys(content).last_matching(prev_requirements);
                 if (value.has_value())
                     return *value;
 
@@ -1773,7 +1796,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Prevunique: {
             // Let temp record be the last record in records which satisfy all of the following requirements:
             auto temp_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.last_matching(prev_unique_requirements);
+                auto value = records_not_above_keys(content).last_matching(prev_unique_requirements);
                 if (value.has_value())
                     return *value;
 
@@ -1787,11 +1810,9 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
                     [](auto const& record) { return record.key; });
 
                 found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                    auto value = content.first_matching([&](auto const& content_record) {
-                        return Key::equals(content_record.key, temp_record_key);
-                    });
-                    if (value.has_value())
-                        return *value;
+                    auto index = index_of_first_record_after(content, temp_record_key, KeyBound::Inclusive);
+                    if (index < content.size() && Key::equals(content[index].key, temp_record_key))
+                        return content[index];
 
                     return Empty {};
                 });
@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -51,11 +50,8 @@ void Index::set_name(String name)
 
 bool Index::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
-    });
-
-    return index != m_records.end();
+    auto index = index_of_first_record_after(records(), key, KeyBound::Inclusive);
+    return index != m_records.size() && Key::equals(m_records[index].key, key);
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
@@ -63,13 +59,7 @@ HTML::SerializationRecord Index::referenced_value(IndexRecord const& index_recor
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return m_object_store
-        ->records()
-        .first_matching([&](auto const& store_record) {
-            return Key::equals(store_record.key, index_record.value);
-        })
-        .value()
-        .value;
+    return m_object_store->record_with_key(index_record.value).value().value;
 }
 
 void Index::clear_records()
@@ -79,47 +69,49 @@ void Index::clear_records()
 
 Optional<IndexRecord&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto records = records_in_range(this->records(), *range);
+    if (records.is_empty())
+        return {};
+    return m_records[records.data() - m_records.data()];
 }
 
 GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
-    GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    auto records_in_range = IndexedDB::records_in_range(this->records(), *range);
+    if (count.has_value() && *count < records_in_range.size())
+        records_in_range = records_in_range.trim(*count);
 
-        if (count.has_value() && records.size() >= *count)
-            break;
-    }
+    GC::ConservativeVector<IndexRecord> records(range->heap());
+    records.ensure_capacity(records_in_range.size());
+    for (auto const& record : records_in_range)
+        records.unchecked_append(record);
 
     return records;
 }
 
 u64 Index::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    return records_in_range(records(), *range).size();
 }
 
 void Index::store_a_record(IndexRecord const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in index’s list of records such that the list is sorted primarily on the records keys, and secondarily on the records values, in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        auto key_comparison = Key::compare_two_keys(a.key, b.key);
-        if (key_comparison != 0)
-            return key_comparison < 0;
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto comparison = Key::compare_two_keys(m_records[middle].key, record.key);
+        if (comparison == 0)
+            comparison = Key::compare_two_keys(m_records[middle].value, record.value);
+
+        if (comparison <= 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
 
-        return Key::compare_two_keys(a.value, b.value) < 0;
-    });
+    m_records.insert(low, record);
 }
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
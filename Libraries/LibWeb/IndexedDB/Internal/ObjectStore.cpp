@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -43,45 +42,44 @@ void ObjectStore::visit_edges(Visitor& visitor)
 
 void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    m_records.remove_all_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto records = records_in_range(this->records(), *range);
+    if (records.is_empty())
+        return;
+
+    m_records.remove(records.data() - m_records.data(), records.size());
 }
 
 bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(key, record.key);
-    });
+    return record_with_key(key).has_value();
+}
 
-    return index != m_records.end();
+Optional<Record const&> ObjectStore::record_with_key(GC::Ref<Key> key) const
+{
+    auto index = index_of_first_record_after(records(), key, KeyBound::Inclusive);
+    if (index == m_records.size() || !Key::equals(m_records[index].key, key))
+        return {};
+    return m_records[index];
 }
 
 void ObjectStore::store_a_record(Record const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        return Key::compare_two_keys(a.key, b.key) < 0;
-    });
+    auto index = index_of_first_record_after(records(), record.key, KeyBound::Exclusive);
+    m_records.insert(index, record);
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    return records_in_range(records(), *range).size();
 }
 
 Optional<Record&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto records = records_in_range(this->records(), *range);
+    if (records.is_empty())
+        return {};
+    return m_records[records.data() - m_records.data()];
 }
 
 void ObjectStore::clear_records()
@@ -91,14 +89,14 @@ void ObjectStore::clear_records()
 
 GC::ConservativeVector<Record> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
-    GC::ConservativeVector<Record> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    auto records_in_range = IndexedDB::records_in_range(this->records(), *range);
+    if (count.has_value() && *count < records_in_range.size())
+        records_in_range = records_in_range.trim(*count);
 
-        if (count.has_value() && records.size() >= *count)
-            break;
-    }
+    GC::ConservativeVector<Record> records(range->heap());
+    records.ensure_capacity(records_in_range.size());
+    for (auto const& record : records_in_range)
+        records.unchecked_append(record);
 
     return records;
 }
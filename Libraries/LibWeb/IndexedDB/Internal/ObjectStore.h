@@ -29,6 +29,46 @@ struct Record {
     HTML::SerializationRecord value;
 };
 
+// NOTE: The lists of records of object stores and indexes are kept sorted by key, so they can be binary searched.
+enum class KeyBound {
+    Inclusive,
+    Exclusive,
+};
+
+// Returns the index of the first record whose key is greater than key, or equal to it if the bound is inclusive.
+template<typename RecordType>
+size_t index_of_first_record_after(ReadonlySpan<RecordType> records, GC::Ref<Key> key, KeyBound bound)
+{
+    size_t low = 0;
+    size_t high = records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto comparison = Key::compare_two_keys(records[middle].key, key);
+        if (comparison < 0 || (comparison == 0 && bound == KeyBound::Exclusive))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+// Returns the records whose key is in range.
+template<typename RecordType>
+ReadonlySpan<RecordType> records_in_range(ReadonlySpan<RecordType> records, IDBKeyRange const& range)
+{
+    size_t start = 0;
+    if (auto lower = range.lower_key())
+        start = index_of_first_record_after(records, *lower, range.lower_open() ? KeyBound::Exclusive : KeyBound::Inclusive);
+
+    size_t end = records.size();
+    if (auto upper = range.upper_key())
+        end = index_of_first_record_after(records, *upper, range.upper_open() ? KeyBound::Inclusive : KeyBound::Exclusive);
+
+    if (end <= start)
+        return {};
+    return records.slice(start, end - start);
+}
+
 // https://w3c.github.io/IndexedDB/#object-store-construct
 class ObjectStore : public JS::Cell {
     GC_CELL(ObjectStore, JS::Cell);
@@ -52,6 +92,7 @@ public:
 
     void remove_records_in_range(GC::Ref<IDBKeyRange> range);
     bool has_record_with_key(GC::Ref<Key> key);
+    Optional<Record const&> record_with_key(GC::Ref<Key> key) const;
     void store_a_record(Record const& record);
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
     Optional<Record&> first_in_range(GC::Ref<IDBKeyRange> range);
@@ -23,6 +23,12 @@
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
 
+namespace Web::Fetch::Fetching {
+
+extern bool g_response_streaming_enabled;
+
+}
+
 namespace Web::Internals {
 
 static u16 s_echo_server_port { 0 };
@@ -310,6 +316,11 @@ void Internals::set_echo_server_port(u16 const port)
     s_echo_server_port = port;
 }
 
+void Internals::set_response_streaming_enabled(bool enabled)
+{
+    Fetch::Fetching::g_response_streaming_enabled = enabled;
+}
+
 void Internals::set_browser_zoom(double factor)
 {
     page().client().page_did_set_browser_zoom(factor);
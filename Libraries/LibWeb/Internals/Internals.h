@@ -59,6 +59,7 @@ public:
 
     static u16 get_echo_server_port();
     static void set_echo_server_port(u16 port);
+    void set_response_streaming_enabled(bool enabled);
 
     void set_browser_zoom(double factor);
 
@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/Time.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
@@ -40,6 +41,13 @@ public:
     ByteBuffer const& body() const { return m_body; }
     void set_body(ByteBuffer body) { m_body = move(body); }
 
+    Requests::RequestPriority priority() const { return m_priority; }
+    void set_priority(Requests::RequestPriority priority) { m_priority = priority; }
+
+    // If set, the request may use compression dictionaries from, and store them into, this partition.
+    Optional<String> const& compression_dictionary_partition() const { return m_compression_dictionary_partition; }
+    void set_compression_dictionary_partition(String partition) { m_compression_dictionary_partition = move(partition); }
+
     void start_timer() { m_load_timer.start(); }
     AK::Duration load_time() const { return m_load_timer.elapsed_time(); }
 
@@ -80,6 +88,8 @@ private:
     ByteString m_method { "GET" };
     HashMap<ByteString, ByteString, CaseInsensitiveStringTraits> m_headers;
     ByteBuffer m_body;
+    Requests::RequestPriority m_priority { Requests::RequestPriority::Medium };
+    Optional<String> m_compression_dictionary_partition;
     Core::ElapsedTimer m_load_timer;
     GC::Root<Page> m_page;
     bool m_main_resource { false };
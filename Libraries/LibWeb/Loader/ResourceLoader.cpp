@@ -431,8 +431,8 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
             //       event loop inside a callback may cause this function object to be destroyed
             //       while we're still calling it.
             ScopeGuard cleanup = [&] {
-                deferred_invoke([this, protocol_request = NonnullRefPtr(protocol_request)] {
-                    finish_network_request(move(protocol_request));
+                deferred_invoke([this, load_request_id = request.id(), protocol_request = NonnullRefPtr(protocol_request)] {
+                    finish_network_request(load_request_id, move(protocol_request));
                 });
             };
             if (network_error.has_value() || (status_code.has_value() && *status_code >= 400 && *status_code <= 599 && (payload.is_empty() || !request.is_main_resource()))) {
@@ -504,7 +504,7 @@ void ResourceLoader::load_unbuffered(LoadRequest& request, GC::Root<OnHeadersRec
     };
 
     auto protocol_complete = [this, on_complete, request, &protocol_request = *protocol_request](u64, Requests::RequestTimingInfo const& timing_info, Optional<Requests::NetworkError> const& network_error) {
-        finish_network_request(protocol_request);
+        finish_network_request(request.id(), protocol_request);
 
         if (!network_error.has_value()) {
             log_success(request);
@@ -531,7 +531,7 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
     if (!headers.contains("User-Agent"))
         headers.set("User-Agent", m_user_agent.to_byte_string());
 
-    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy);
+    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy, request.priority(), request.compression_dictionary_partition());
     if (!protocol_request) {
         log_failure(request, "Failed to initiate load"sv);
         return nullptr;
@@ -546,9 +546,39 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
         on_load_counter_change();
 
     m_active_requests.set(*protocol_request);
+    m_active_requests_by_load_request_id.set(request.id(), *protocol_request);
     return protocol_request;
 }
 
+void ResourceLoader::set_request_priority(int load_request_id, Requests::RequestPriority priority)
+{
+    if (auto protocol_request = m_active_requests_by_load_request_id.get(load_request_id); protocol_request.has_value())
+        (*protocol_request)->set_priority(priority);
+}
+
+void ResourceLoader::suspend_request(int load_request_id)
+{
+    if (auto protocol_request = m_active_requests_by_load_request_id.get(load_request_id); protocol_request.has_value())
+        (*protocol_request)->suspend();
+}
+
+void ResourceLoader::resume_request(int load_request_id)
+{
+    if (auto protocol_request = m_active_requests_by_load_request_id.get(load_request_id); protocol_request.has_value())
+        (*protocol_request)->resume();
+}
+
+void ResourceLoader::stop_request(int load_request_id)
+{
+    auto protocol_request = m_active_requests_by_load_request_id.get(load_request_id);
+    if (!protocol_request.has_value())
+        return;
+
+    auto request = *protocol_request;
+    request->stop();
+    finish_network_request(load_request_id, move(request));
+}
+
 void ResourceLoader::handle_network_response_headers(LoadRequest const& request, HTTP::HeaderMap const& response_headers)
 {
     if (!request.page())
@@ -566,8 +596,11 @@ void ResourceLoader::handle_network_response_headers(LoadRequest const& request,
     }
 }
 
-void ResourceLoader::finish_network_request(NonnullRefPtr<Requests::Request> protocol_request)
+void ResourceLoader::finish_network_request(int load_request_id, NonnullRefPtr<Requests::Request> protocol_request)
 {
+    if (auto it = m_active_requests_by_load_request_id.find(load_request_id); it != m_active_requests_by_load_request_id.end() && it->value.ptr() == protocol_request.ptr())
+        m_active_requests_by_load_request_id.remove(it);
+
     --m_pending_loads;
     if (on_load_counter_change)
         on_load_counter_change();
@@ -582,6 +615,8 @@ void ResourceLoader::clear_cache()
 {
     dbgln_if(CACHE_DEBUG, "Clearing {} items from ResourceLoader cache", s_resource_cache.size());
     s_resource_cache.clear();
+
+    m_request_client->clear_compression_dictionaries();
 }
 
 void ResourceLoader::evict_from_cache(LoadRequest const& request)
@@ -9,9 +9,11 @@
 
 #include <AK/ByteString.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/HashTable.h>
 #include <LibCore/EventReceiver.h>
 #include <LibRequests/Forward.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Loader/Resource.h>
 #include <LibWeb/Loader/UserAgent.h>
@@ -38,6 +40,18 @@ public:
 
     void load_unbuffered(LoadRequest&, GC::Root<OnHeadersReceived>, GC::Root<OnDataReceived>, GC::Root<OnComplete>);
 
+    // Changes the priority of the network request started for the given LoadRequest, if it is still in flight.
+    void set_request_priority(int load_request_id, Requests::RequestPriority);
+
+    // Stops (and later resumes) reading the response of the network request started for the given LoadRequest, so
+    // that RequestServer stops receiving it while its consumer isn't keeping up.
+    void suspend_request(int load_request_id);
+    void resume_request(int load_request_id);
+
+    // Stops the network request started for the given LoadRequest, if it is still in flight. None of the callbacks it
+    // was loaded with are invoked afterwards.
+    void stop_request(int load_request_id);
+
     Requests::RequestClient& request_client() { return *m_request_client; }
 
     void prefetch_dns(URL::URL const&);
@@ -76,13 +90,14 @@ private:
 
     RefPtr<Requests::Request> start_network_request(LoadRequest const&);
     void handle_network_response_headers(LoadRequest const&, HTTP::HeaderMap const&);
-    void finish_network_request(NonnullRefPtr<Requests::Request>);
+    void finish_network_request(int load_request_id, NonnullRefPtr<Requests::Request>);
 
     int m_pending_loads { 0 };
 
     GC::Heap& m_heap;
     NonnullRefPtr<Requests::RequestClient> m_request_client;
     HashTable<NonnullRefPtr<Requests::Request>> m_active_requests;
+    HashMap<int, NonnullRefPtr<Requests::Request>> m_active_requests_by_load_request_id;
 
     String m_user_agent;
     String m_platform;
@@ -279,7 +279,7 @@ WebIDL::ExceptionOr<GC::Ref<ReadableStreamDefaultReader>> ReadableStream::get_a_
 }
 
 // https://streams.spec.whatwg.org/#readablestream-pull-from-bytes
-WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
+WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer& bytes)
 {
     auto& realm = this->realm();
 
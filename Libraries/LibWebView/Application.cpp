@@ -12,6 +12,7 @@
 #include <LibCore/TimeZoneWatcher.h>
 #include <LibDevTools/DevToolsServer.h>
 #include <LibFileSystem/FileSystem.h>
+#include <LibIPC/Statistics.h>
 #include <LibImageDecoderClient/Client.h>
 #include <LibWeb/CSS/PropertyID.h>
 #include <LibWebView/Application.h>
@@ -115,12 +116,19 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool disable_site_isolation = false;
     bool enable_idl_tracing = false;
     bool enable_http_cache = false;
+    bool enable_response_streaming = false;
     bool enable_autoplay = false;
     bool expose_internals_object = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
     bool disable_scrollbar_painting = false;
+    bool enable_ipc_statistics = false;
+    bool enable_connection_statistics = false;
+    Optional<StringView> record_network_path;
+    Optional<StringView> replay_network_path;
+    Optional<u32> replay_latency_ms;
+    Optional<u64> replay_bandwidth;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("The Ladybird web browser :^)");
@@ -162,6 +170,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
+    args_parser.add_option(enable_response_streaming, "Stream HTTP(S) response bodies as they are received", "enable-response-streaming");
     args_parser.add_option(enable_autoplay, "Enable multimedia autoplay", "enable-autoplay");
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
@@ -172,6 +181,12 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(dns_server_port, "Set the DNS server port", "dns-port", 0, "port (default: 53 or 853 if --dot)");
     args_parser.add_option(use_dns_over_tls, "Use DNS over TLS", "dot");
     args_parser.add_option(validate_dnssec_locally, "Validate DNSSEC locally", "dnssec");
+    args_parser.add_option(enable_ipc_statistics, "Collect IPC statistics in all processes, dumped as JSON on SIGUSR1", "ipc-stats");
+    args_parser.add_option(enable_connection_statistics, "Collect per-origin connection statistics in RequestServer, dumped as JSON on SIGUSR2", "connection-stats");
+    args_parser.add_option(record_network_path, "Record all network responses into an archive", "record-network", 0, "path");
+    args_parser.add_option(replay_network_path, "Serve all network responses from an archive made with --record-network", "replay-network", 0, "path");
+    args_parser.add_option(replay_latency_ms, "Latency of responses served with --replay-network (default: as recorded)", "replay-latency", 0, "milliseconds");
+    args_parser.add_option(replay_bandwidth, "Bandwidth of responses served with --replay-network (default: unlimited)", "replay-bandwidth", 0, "bytes-per-second");
 
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
@@ -218,6 +233,12 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     if (profile_process.has_value())
         profile_process_type = process_type_from_name(*profile_process);
 
+    Optional<NetworkArchiveSettings> network_archive_settings;
+    if (replay_network_path.has_value())
+        network_archive_settings = ReplayNetwork { *replay_network_path, replay_latency_ms, replay_bandwidth };
+    else if (record_network_path.has_value())
+        network_archive_settings = RecordNetwork { *record_network_path };
+
     // Disable site isolation when debugging WebContent. Otherwise, the process swap may interfere with the gdb session.
     if (debug_process_type == ProcessType::WebContent)
         disable_site_isolation = true;
@@ -239,7 +260,10 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
                           ? DNSSettings(DNSOverTLS(dns_server_address.release_value(), *dns_server_port, validate_dnssec_locally))
                           : DNSSettings(DNSOverUDP(dns_server_address.release_value(), *dns_server_port, validate_dnssec_locally)) }
                 : OptionalNone()),
+        .network_archive_settings = move(network_archive_settings),
         .devtools_port = devtools_port,
+        .enable_ipc_statistics = enable_ipc_statistics ? EnableIPCStatistics::Yes : EnableIPCStatistics::No,
+        .enable_connection_statistics = enable_connection_statistics ? EnableConnectionStatistics::Yes : EnableConnectionStatistics::No,
     };
 
     if (window_width.has_value())
@@ -259,6 +283,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .disable_site_isolation = disable_site_isolation ? DisableSiteIsolation::Yes : DisableSiteIsolation::No,
         .enable_idl_tracing = enable_idl_tracing ? EnableIDLTracing::Yes : EnableIDLTracing::No,
         .enable_http_cache = enable_http_cache ? EnableHTTPCache::Yes : EnableHTTPCache::No,
+        .enable_response_streaming = enable_response_streaming ? EnableResponseStreaming::Yes : EnableResponseStreaming::No,
         .expose_internals_object = expose_internals_object ? ExposeInternalsObject::Yes : ExposeInternalsObject::No,
         .force_cpu_painting = force_cpu_painting ? ForceCPUPainting::Yes : ForceCPUPainting::No,
         .force_fontconfig = force_fontconfig ? ForceFontconfig::Yes : ForceFontconfig::No,
@@ -270,6 +295,10 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     create_platform_options(m_browser_options, m_web_content_options);
 
     m_event_loop = create_platform_event_loop();
+
+    if (m_browser_options.enable_ipc_statistics == EnableIPCStatistics::Yes)
+        IPC::Statistics::enable();
+
     TRY(launch_services());
 
     return {};
@@ -571,6 +600,20 @@ ErrorOr<LexicalPath> Application::path_for_downloaded_file(StringView file) cons
     return LexicalPath::join(downloads_directory, file);
 }
 
+void Application::dump_connection_statistics() const
+{
+    if (!m_request_server_client)
+        return;
+
+    if (m_browser_options.enable_connection_statistics == EnableConnectionStatistics::No) {
+        dbgln("Connection statistics are only collected with --connection-stats");
+        return;
+    }
+
+    auto statistics = m_request_server_client->connection_statistics();
+    dbgln("{}", statistics);
+}
+
 ErrorOr<Application::DevtoolsState> Application::toggle_devtools_enabled()
 {
     if (m_devtools) {
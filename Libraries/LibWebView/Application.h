@@ -63,6 +63,8 @@ public:
 
     ErrorOr<LexicalPath> path_for_downloaded_file(StringView file) const;
 
+    void dump_connection_statistics() const;
+
     enum class DevtoolsState {
         Disabled,
         Enabled,
@@ -18,6 +18,7 @@
 namespace WebView {
 
 static constexpr auto DATABASE_SYNCHRONIZATION_TIMER = AK::Duration::from_seconds(30);
+static constexpr size_t MINIMUM_EXPIRY_QUEUE_SIZE_TO_REBUILD = 1024;
 
 ErrorOr<NonnullOwnPtr<CookieJar>> CookieJar::create(Database& database)
 {
@@ -45,6 +46,9 @@ ErrorOr<NonnullOwnPtr<CookieJar>> CookieJar::create(Database& database)
     statements.insert_cookie = TRY(database.prepare_statement("INSERT OR REPLACE INTO Cookies VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
     statements.expire_cookie = TRY(database.prepare_statement("DELETE FROM Cookies WHERE (expiry_time < ?);"sv));
     statements.select_all_cookies = TRY(database.prepare_statement("SELECT * FROM Cookies;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
+    statements.rollback_transaction = TRY(database.prepare_statement("ROLLBACK;"sv));
 
     return adopt_own(*new CookieJar { PersistedStorage { database, statements } });
 }
@@ -67,11 +71,16 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage)
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
         [this]() {
-            for (auto const& it : m_transient_storage.take_dirty_cookies())
-                m_persisted_storage->insert_cookie(it.value);
-
+            auto dirty_cookies = m_transient_storage.take_dirty_cookies();
             auto now = m_transient_storage.purge_expired_cookies();
-            m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
+
+            if (auto result = m_persisted_storage->synchronize(dirty_cookies, now); result.is_error()) {
+                dbgln("Unable to synchronize cookies with the database: {}", result.error());
+
+                // NOTE: Nothing was written, so try again with these cookies on the next synchronization. Expired
+                //       cookies will be deleted then as well.
+                m_transient_storage.restore_dirty_cookies(move(dirty_cookies));
+            }
         });
     m_persisted_storage->synchronization_timer->start();
 }
@@ -534,11 +543,13 @@ void CookieJar::store_cookie(Web::Cookie::ParsedCookie const& parsed_cookie, con
 Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url, StringView canonicalized_domain, Web::Cookie::Source source, MatchingCookiesSpecMode mode)
 {
     auto now = UnixDateTime::now();
+    auto request_path = url.serialize_path();
 
     // 1. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](Web::Cookie::Cookie& cookie) {
+    // NOTE: A cookie can only match if the canonicalized host is its domain, or a subdomain of its domain.
+    m_transient_storage.for_each_cookie_with_domain_of(canonicalized_domain, [&](Web::Cookie::Cookie& cookie) {
         // * Either:
         //     The cookie's host-only-flag is true and the canonicalized host of the retrieval's URI is identical to
         //     the cookie's domain.
@@ -552,7 +563,7 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
             return;
 
         // * The retrieval's URI's path path-matches the cookie's path.
-        if (!path_matches(url.serialize_path(), cookie.path))
+        if (!path_matches(request_path, cookie.path))
             return;
 
         // * If the cookie's secure-only-flag is true, then the retrieval's URI must denote a "secure" connection (as
@@ -611,19 +622,51 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
 
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
-    m_cookies = move(cookies);
+    m_cookies_by_domain.clear();
+    m_size = cookies.size();
+
+    for (auto& [key, cookie] : cookies)
+        m_cookies_by_domain.ensure(key.domain).set(key, cookie);
+
+    rebuild_expiry_queue();
     purge_expired_cookies();
 }
 
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
 {
-    m_cookies.set(key, cookie);
+    auto& cookies = m_cookies_by_domain.ensure(key.domain);
+
+    auto old_cookie = cookies.get(key);
+    auto expiry_time_changed = !old_cookie.has_value() || old_cookie->expiry_time != cookie.expiry_time;
+
+    if (cookies.set(key, cookie) == HashSetResult::InsertedNewEntry)
+        ++m_size;
+
+    if (expiry_time_changed) {
+        m_expiry_queue.insert(cookie.expiry_time, key);
+
+        // Cookies that are updated often (e.g. those with a Max-Age) leave many stale entries behind in the queue.
+        if (m_expiry_queue.size() > max(m_size * 2, MINIMUM_EXPIRY_QUEUE_SIZE_TO_REBUILD))
+            rebuild_expiry_queue();
+    }
+
     m_dirty_cookies.set(move(key), move(cookie));
 }
 
+void CookieJar::TransientStorage::restore_dirty_cookies(Cookies cookies)
+{
+    // NOTE: Cookies which were changed again since they were taken are more recent, so we keep those instead.
+    for (auto& [key, cookie] : cookies)
+        m_dirty_cookies.set(move(key), move(cookie), AK::HashSetExistingEntryBehavior::Keep);
+}
+
 Optional<Web::Cookie::Cookie const&> CookieJar::TransientStorage::get_cookie(CookieStorageKey const& key)
 {
-    return m_cookies.get(key);
+    auto cookies = m_cookies_by_domain.get(key.domain);
+    if (!cookies.has_value())
+        return {};
+
+    return cookies->get(key);
 }
 
 UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Duration> offset)
@@ -636,25 +679,85 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
             cookie.value.expiry_time -= *offset;
     }
 
-    auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
-    m_cookies.remove_all_matching(is_expired);
+    while (!m_expiry_queue.is_empty() && m_expiry_queue.peek_min_key() < now) {
+        auto key = m_expiry_queue.pop_min();
+
+        auto cookies = m_cookies_by_domain.find(key.domain);
+        if (cookies == m_cookies_by_domain.end())
+            continue;
+
+        // NOTE: If the cookie has been removed, or has since been given a later expiry time, this entry is stale.
+        auto cookie = cookies->value.find(key);
+        if (cookie == cookies->value.end() || cookie->value.expiry_time >= now)
+            continue;
+
+        cookies->value.remove(cookie);
+        --m_size;
+
+        if (cookies->value.is_empty())
+            m_cookies_by_domain.remove(cookies);
+    }
 
     return now;
 }
 
 void CookieJar::TransientStorage::expire_and_purge_all_cookies()
 {
-    for (auto& [key, value] : m_cookies) {
-        value.expiry_time = UnixDateTime::earliest();
-        set_cookie(key, value);
+    for (auto& [domain, cookies] : m_cookies_by_domain) {
+        for (auto& [key, value] : cookies) {
+            value.expiry_time = UnixDateTime::earliest();
+            m_dirty_cookies.set(key, value);
+        }
     }
 
-    purge_expired_cookies();
+    m_cookies_by_domain.clear();
+    m_expiry_queue.clear();
+    m_size = 0;
 }
 
-void CookieJar::PersistedStorage::insert_cookie(Web::Cookie::Cookie const& cookie)
+void CookieJar::TransientStorage::rebuild_expiry_queue()
 {
-    database.execute_statement(
+    Vector<UnixDateTime> expiry_times;
+    Vector<CookieStorageKey> keys;
+    expiry_times.ensure_capacity(m_size);
+    keys.ensure_capacity(m_size);
+
+    for (auto const& [domain, cookies] : m_cookies_by_domain) {
+        for (auto const& [key, cookie] : cookies) {
+            expiry_times.unchecked_append(cookie.expiry_time);
+            keys.unchecked_append(key);
+        }
+    }
+
+    m_expiry_queue = { expiry_times.data(), keys.data(), keys.size() };
+}
+
+ErrorOr<void> CookieJar::PersistedStorage::synchronize(TransientStorage::Cookies const& dirty_cookies, UnixDateTime now)
+{
+    // NOTE: Write all changes in a single transaction. Otherwise, SQLite commits (and syncs to disk) after every
+    //       statement, which adds up quickly when many cookies have changed.
+    TRY(database.try_execute_statement(statements.begin_transaction, {}));
+
+    auto result = [&]() -> ErrorOr<void> {
+        for (auto const& it : dirty_cookies)
+            TRY(insert_cookie(it.value));
+
+        TRY(database.try_execute_statement(statements.expire_cookie, {}, now));
+        TRY(database.try_execute_statement(statements.commit_transaction, {}));
+        return {};
+    }();
+
+    if (result.is_error()) {
+        if (auto rollback_result = database.try_execute_statement(statements.rollback_transaction, {}); rollback_result.is_error())
+            dbgln("Unable to roll back cookie transaction: {}", rollback_result.error());
+    }
+
+    return result;
+}
+
+ErrorOr<void> CookieJar::PersistedStorage::insert_cookie(Web::Cookie::Cookie const& cookie)
+{
+    return database.try_execute_statement(
         statements.insert_cookie,
         {},
         cookie.name,
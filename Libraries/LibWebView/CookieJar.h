@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/BinaryHeap.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
@@ -34,6 +35,9 @@ class CookieJar {
         Database::StatementID insert_cookie { 0 };
         Database::StatementID expire_cookie { 0 };
         Database::StatementID select_all_cookies { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
+        Database::StatementID rollback_transaction { 0 };
     };
 
     class TransientStorage {
@@ -44,36 +48,78 @@ class CookieJar {
         void set_cookie(CookieStorageKey, Web::Cookie::Cookie);
         Optional<Web::Cookie::Cookie const&> get_cookie(CookieStorageKey const&);
 
-        size_t size() const { return m_cookies.size(); }
+        size_t size() const { return m_size; }
 
         UnixDateTime purge_expired_cookies(Optional<AK::Duration> offset = {});
         void expire_and_purge_all_cookies();
 
         auto take_dirty_cookies() { return move(m_dirty_cookies); }
+        void restore_dirty_cookies(Cookies);
 
         template<typename Callback>
         void for_each_cookie(Callback callback)
         {
-            using ReturnType = InvokeResult<Callback, Web::Cookie::Cookie&>;
-
-            for (auto& it : m_cookies) {
-                if constexpr (IsSame<ReturnType, IterationDecision>) {
-                    if (callback(it.value) == IterationDecision::Break)
+            for (auto& domain : m_cookies_by_domain) {
+                for (auto& it : domain.value) {
+                    if (invoke_callback(callback, it.value) == IterationDecision::Break)
                         return;
-                } else {
-                    static_assert(IsSame<ReturnType, void>);
-                    callback(it.value);
                 }
             }
         }
 
+        // Invokes the callback for each cookie whose domain is the given host, or one of its parent domains. These are
+        // the only cookies which the host may domain-match, so this avoids visiting every cookie in the jar.
+        template<typename Callback>
+        void for_each_cookie_with_domain_of(StringView host, Callback callback)
+        {
+            while (true) {
+                if (auto it = m_cookies_by_domain.find(host); it != m_cookies_by_domain.end()) {
+                    for (auto& cookie : it->value) {
+                        if (invoke_callback(callback, cookie.value) == IterationDecision::Break)
+                            return;
+                    }
+                }
+
+                auto separator = host.find('.');
+                if (!separator.has_value())
+                    return;
+                host = host.substring_view(*separator + 1);
+            }
+        }
+
     private:
-        Cookies m_cookies;
+        template<typename Callback>
+        static IterationDecision invoke_callback(Callback& callback, Web::Cookie::Cookie& cookie)
+        {
+            using ReturnType = InvokeResult<Callback, Web::Cookie::Cookie&>;
+
+            if constexpr (IsSame<ReturnType, IterationDecision>) {
+                return callback(cookie);
+            } else {
+                static_assert(IsSame<ReturnType, void>);
+                callback(cookie);
+                return IterationDecision::Continue;
+            }
+        }
+
+        void rebuild_expiry_queue();
+
+        // Cookies are bucketed by their domain, so that retrieving the cookies for a host only has to look at the
+        // buckets of the host and its parent domains.
+        HashMap<String, Cookies> m_cookies_by_domain;
+        size_t m_size { 0 };
+
+        // Cookies ordered by their expiry time, so that purging expired cookies does not have to visit every cookie.
+        // Entries are not removed when a cookie is updated or removed; stale entries are instead skipped once they
+        // reach the front of the queue.
+        BinaryHeap<UnixDateTime, CookieStorageKey, 0> m_expiry_queue;
+
         Cookies m_dirty_cookies;
     };
 
     struct PersistedStorage {
-        void insert_cookie(Web::Cookie::Cookie const& cookie);
+        ErrorOr<void> synchronize(TransientStorage::Cookies const& dirty_cookies, UnixDateTime now);
+        ErrorOr<void> insert_cookie(Web::Cookie::Cookie const& cookie);
         TransientStorage::Cookies select_all_cookies();
 
         Database& database;
@@ -79,6 +79,17 @@ ErrorOr<Database::StatementID> Database::prepare_statement(StringView statement)
 }
 
 void Database::execute_statement(StatementID statement_id, OnResult on_result)
+{
+    SQL_MUST(step_statement(statement_id, move(on_result)));
+}
+
+ErrorOr<void> Database::try_execute_statement(StatementID statement_id, OnResult on_result)
+{
+    SQL_TRY(step_statement(statement_id, move(on_result)));
+    return {};
+}
+
+int Database::step_statement(StatementID statement_id, OnResult on_result)
 {
     auto* statement = prepared_statement(statement_id);
 
@@ -87,8 +98,7 @@ void Database::execute_statement(StatementID statement_id, OnResult on_result)
 
         switch (result) {
         case SQLITE_DONE:
-            SQL_MUST(sqlite3_reset(statement));
-            return;
+            return sqlite3_reset(statement);
 
         case SQLITE_ROW:
             if (on_result)
@@ -96,8 +106,9 @@ void Database::execute_statement(StatementID statement_id, OnResult on_result)
             continue;
 
         default:
-            SQL_MUST(result);
-            return;
+            // NOTE: Reset the statement even if it failed, so that it may be executed again.
+            sqlite3_reset(statement);
+            return result;
         }
     }
 }
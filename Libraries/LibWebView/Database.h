@@ -39,12 +39,26 @@ public:
         execute_statement(statement_id, move(on_result));
     }
 
+    // Like execute_statement(), but returns an error if the statement fails, rather than crashing.
+    ErrorOr<void> try_execute_statement(StatementID, OnResult on_result);
+
+    template<typename... PlaceholderValues>
+    ErrorOr<void> try_execute_statement(StatementID statement_id, OnResult on_result, PlaceholderValues&&... placeholder_values)
+    {
+        int index = 1;
+        (apply_placeholder(statement_id, index++, forward<PlaceholderValues>(placeholder_values)), ...);
+
+        return try_execute_statement(statement_id, move(on_result));
+    }
+
     template<typename ValueType>
     ValueType result_column(StatementID, int column);
 
 private:
     explicit Database(sqlite3*);
 
+    int step_statement(StatementID, OnResult on_result);
+
     template<typename ValueType>
     void apply_placeholder(StatementID statement_id, int index, ValueType const& value);
 
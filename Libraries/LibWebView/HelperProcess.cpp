@@ -33,6 +33,8 @@ static ErrorOr<NonnullRefPtr<ClientType>> launch_server_process(
 
     if (browser_options.debug_helper_process == process_type)
         arguments.append("--wait-for-debugger"sv);
+    if (browser_options.enable_ipc_statistics == WebView::EnableIPCStatistics::Yes)
+        arguments.append("--ipc-stats"sv);
 
     for (auto [i, path] : enumerate(candidate_server_paths)) {
         Core::ProcessSpawnOptions options { .name = server_name, .arguments = arguments };
@@ -112,6 +114,8 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
         arguments.append("--enable-idl-tracing"sv);
     if (web_content_options.enable_http_cache == WebView::EnableHTTPCache::Yes)
         arguments.append("--enable-http-cache"sv);
+    if (web_content_options.enable_response_streaming == WebView::EnableResponseStreaming::Yes)
+        arguments.append("--enable-response-streaming"sv);
     if (web_content_options.expose_internals_object == WebView::ExposeInternalsObject::Yes)
         arguments.append("--expose-internals-object"sv);
     if (web_content_options.force_cpu_painting == WebView::ForceCPUPainting::Yes)
@@ -206,6 +210,23 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
     for (auto const& certificate : WebView::Application::browser_options().certificates)
         arguments.append(ByteString::formatted("--certificate={}", certificate));
 
+    if (auto const& network_archive_settings = WebView::Application::browser_options().network_archive_settings; network_archive_settings.has_value()) {
+        network_archive_settings->visit(
+            [&](WebView::RecordNetwork const& record_network) {
+                arguments.append(ByteString::formatted("--record-network={}", record_network.archive_path));
+            },
+            [&](WebView::ReplayNetwork const& replay_network) {
+                arguments.append(ByteString::formatted("--replay-network={}", replay_network.archive_path));
+                if (replay_network.latency_ms.has_value())
+                    arguments.append(ByteString::formatted("--replay-latency={}", *replay_network.latency_ms));
+                if (replay_network.bandwidth_in_bytes_per_second.has_value())
+                    arguments.append(ByteString::formatted("--replay-bandwidth={}", *replay_network.bandwidth_in_bytes_per_second));
+            });
+    }
+
+    if (WebView::Application::browser_options().enable_connection_statistics == WebView::EnableConnectionStatistics::Yes)
+        arguments.append("--connection-stats"sv);
+
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
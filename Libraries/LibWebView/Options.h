@@ -52,6 +52,16 @@ enum class EnableAutoplay {
     Yes,
 };
 
+enum class EnableIPCStatistics {
+    No,
+    Yes,
+};
+
+enum class EnableConnectionStatistics {
+    No,
+    Yes,
+};
+
 struct SystemDNS { };
 struct DNSOverTLS {
     ByteString server_address;
@@ -66,6 +76,17 @@ struct DNSOverUDP {
 
 using DNSSettings = Variant<SystemDNS, DNSOverTLS, DNSOverUDP>;
 
+struct RecordNetwork {
+    ByteString archive_path;
+};
+struct ReplayNetwork {
+    ByteString archive_path;
+    Optional<u32> latency_ms;
+    Optional<u64> bandwidth_in_bytes_per_second;
+};
+
+using NetworkArchiveSettings = Variant<RecordNetwork, ReplayNetwork>;
+
 constexpr inline u16 default_devtools_port = 6000;
 
 struct BrowserOptions {
@@ -84,7 +105,10 @@ struct BrowserOptions {
     Optional<ProcessType> profile_helper_process {};
     Optional<ByteString> webdriver_content_ipc_path {};
     Optional<DNSSettings> dns_settings {};
+    Optional<NetworkArchiveSettings> network_archive_settings {};
     Optional<u16> devtools_port;
+    EnableIPCStatistics enable_ipc_statistics { EnableIPCStatistics::No };
+    EnableConnectionStatistics enable_connection_statistics { EnableConnectionStatistics::No };
 };
 
 enum class IsLayoutTestMode {
@@ -107,6 +131,11 @@ enum class EnableHTTPCache {
     Yes,
 };
 
+enum class EnableResponseStreaming {
+    No,
+    Yes,
+};
+
 enum class DisableSiteIsolation {
     No,
     Yes,
@@ -147,6 +176,7 @@ struct WebContentOptions {
     DisableSiteIsolation disable_site_isolation { DisableSiteIsolation::No };
     EnableIDLTracing enable_idl_tracing { EnableIDLTracing::No };
     EnableHTTPCache enable_http_cache { EnableHTTPCache::No };
+    EnableResponseStreaming enable_response_streaming { EnableResponseStreaming::No };
     ExposeInternalsObject expose_internals_object { ExposeInternalsObject::No };
     ForceCPUPainting force_cpu_painting { ForceCPUPainting::No };
     ForceFontconfig force_fontconfig { ForceFontconfig::No };
@@ -47,6 +47,7 @@ static ByteString pascal_case(ByteString const& identifier)
 struct Message {
     ByteString name;
     bool is_synchronous { false };
+    bool is_coalescable { false };
     Vector<Parameter> inputs;
     Vector<Parameter> outputs;
 
@@ -194,7 +195,7 @@ Vector<Endpoint> parse(ByteBuffer const& file_contents)
                 parameter.type_for_encoding = parameter.type.replace("Vector"sv, "ReadonlySpan"sv, ReplaceMode::FirstOnly);
             } else if (parameter.type.is_one_of("String"sv, "ByteString"sv)) {
                 parameter.type_for_encoding = "StringView"sv;
-            } else if (parameter.type == "ByteBuffer"sv) {
+            } else if (parameter.type.is_one_of("ByteBuffer"sv, "IPC::LargeBytes"sv)) {
                 parameter.type_for_encoding = "ReadonlyBytes"sv;
             } else {
                 parameter.type_for_encoding = parameter.type;
@@ -227,6 +228,25 @@ Vector<Endpoint> parse(ByteBuffer const& file_contents)
     auto parse_message = [&] {
         Message message;
         consume_whitespace();
+        if (lexer.consume_specific('[')) {
+            for (;;) {
+                if (lexer.consume_specific(']')) {
+                    consume_whitespace();
+                    break;
+                }
+                if (lexer.consume_specific(',')) {
+                    consume_whitespace();
+                }
+                auto attribute = lexer.consume_until([](char ch) { return ch == ']' || ch == ','; });
+                if (attribute == "Coalesce"sv) {
+                    message.is_coalescable = true;
+                } else {
+                    warnln("Unknown message attribute: {}", attribute);
+                    VERIFY_NOT_REACHED();
+                }
+                consume_whitespace();
+            }
+        }
         message.name = lexer.consume_until([](char ch) { return isspace(ch) || ch == '('; });
         consume_whitespace();
         assert_specific('(');
@@ -243,6 +263,17 @@ Vector<Endpoint> parse(ByteBuffer const& file_contents)
         else
             VERIFY_NOT_REACHED();
 
+        if (message.is_coalescable) {
+            if (message.is_synchronous) {
+                warnln("Synchronous message {} cannot be coalesced", message.name);
+                VERIFY_NOT_REACHED();
+            }
+            if (!message.inputs.is_empty() && !is_primitive_type(message.inputs.first().type)) {
+                warnln("The first parameter of coalesced message {} must be a primitive type", message.name);
+                VERIFY_NOT_REACHED();
+            }
+        }
+
         consume_whitespace();
 
         if (message.is_synchronous) {
@@ -358,7 +389,7 @@ ByteString constructor_for_message(ByteString const& name, Vector<Parameter> con
     return builder.to_byte_string();
 }
 
-void do_message(SourceGenerator message_generator, ByteString const& name, Vector<Parameter> const& parameters, ByteString const& response_type = {})
+void do_message(SourceGenerator message_generator, ByteString const& name, Vector<Parameter> const& parameters, ByteString const& response_type = {}, bool is_coalescable = false)
 {
     auto pascal_name = pascal_case(name);
     message_generator.set("message.name", name);
@@ -403,6 +434,7 @@ public:)~~~");
     virtual i32 message_id() const override { return (int)MessageID::@message.pascal_name@; }
     static i32 static_message_id() { return (int)MessageID::@message.pascal_name@; }
     virtual const char* message_name() const override { return "@endpoint.name@::@message.pascal_name@"; }
+    static constexpr StringView static_message_name() { return "@endpoint.name@::@message.pascal_name@"sv; }
 
     static ErrorOr<NonnullOwnPtr<@message.pascal_name@>> decode(Stream& stream, Queue<IPC::File>& files)
     {
@@ -465,8 +497,23 @@ public:)~~~");
         auto parameter_generator = message_generator.fork();
 
         parameter_generator.set("parameter.name", parameter.name);
-        parameter_generator.append(R"~~~(
+
+        // IPC::LargeBytes parameters are passed to static_encode() as ReadonlyBytes.
+        if (parameter.type == "IPC::LargeBytes"sv) {
+            parameter_generator.append(R"~~~(
+        TRY(stream.encode_large_bytes(@parameter.name@));)~~~");
+        } else {
+            parameter_generator.append(R"~~~(
         TRY(stream.encode(@parameter.name@));)~~~");
+        }
+    }
+
+    if (is_coalescable) {
+        // Messages are coalesced with a pending message of the same type only if their first parameter is equal. This
+        // keeps messages that are addressed to different pages (or other targets) from superseding each other.
+        message_generator.set("message.coalescing_discriminator", parameters.is_empty() ? "0" : ByteString::formatted("static_cast<u64>({})", parameters.first().name));
+        message_generator.append(R"~~~(
+        buffer.set_coalescing_key({ ENDPOINT_MAGIC, (int)MessageID::@message.pascal_name@, @message.coalescing_discriminator@ });)~~~");
     }
 
     message_generator.appendln(R"~~~(
@@ -649,6 +696,8 @@ void generate_proxy_method(SourceGenerator& message_generator, Endpoint const& e
         }
     } else {
         message_generator.append(R"~~~());
+        if (IPC::Statistics::is_enabled()) [[unlikely]]
+            IPC::Statistics::the().record_sent_message(Messages::@endpoint.name@::@message.pascal_name@::static_message_name(), message_buffer.data().size());
         MUST(m_connection.post_message(move(message_buffer))); )~~~");
     }
 
@@ -683,7 +732,7 @@ void build_endpoint(SourceGenerator generator, Endpoint const& endpoint)
             response_name = message.response_name();
             do_message(generator.fork(), response_name, message.outputs);
         }
-        do_message(generator.fork(), message.name, message.inputs, response_name);
+        do_message(generator.fork(), message.name, message.inputs, response_name, message.is_coalescable);
     }
 
     generator.appendln(R"~~~(
@@ -897,6 +946,7 @@ void build(StringBuilder& builder, Vector<Endpoint> const& endpoints)
 #include <LibIPC/Encoder.h>
 #include <LibIPC/File.h>
 #include <LibIPC/Message.h>
+#include <LibIPC/Statistics.h>
 #include <LibIPC/Stub.h>
 
 #if defined(AK_COMPILER_CLANG)
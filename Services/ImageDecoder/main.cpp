@@ -11,6 +11,7 @@
 #include <LibCore/EventLoop.h>
 #include <LibCore/Process.h>
 #include <LibIPC/SingleServer.h>
+#include <LibIPC/Statistics.h>
 #include <LibMain/Main.h>
 
 #if defined(AK_OS_MACOS)
@@ -24,9 +25,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     Core::ArgsParser args_parser;
     StringView mach_server_name;
     bool wait_for_debugger = false;
+    bool enable_ipc_statistics = false;
 
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
+    args_parser.add_option(enable_ipc_statistics, "Collect IPC statistics, dumped as JSON on SIGUSR1", "ipc-stats");
     args_parser.parse(arguments);
 
     if (wait_for_debugger)
@@ -34,6 +37,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     Core::EventLoop event_loop;
 
+    if (enable_ipc_statistics)
+        IPC::Statistics::enable();
+
 #if defined(AK_OS_MACOS)
     if (!mach_server_name.is_empty())
         Core::Platform::register_with_mach_server(mach_server_name);
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
+#include <AK/StringBuilder.h>
+#include <RequestServer/CompressionDictionaryStore.h>
+
+namespace RequestServer {
+
+// https://www.rfc-editor.org/rfc/rfc9842#name-id
+static constexpr size_t maximum_dictionary_id_length = 1024;
+
+CompressionDictionaryStore& CompressionDictionaryStore::the()
+{
+    static CompressionDictionaryStore store;
+    return store;
+}
+
+// Dictionaries may only be used in secure contexts.
+bool CompressionDictionaryStore::may_use_dictionaries_for(URL::URL const& url)
+{
+    if (url.scheme() == "https"sv)
+        return true;
+
+    if (url.scheme() != "http"sv || !url.host().has_value())
+        return false;
+
+    auto host = url.serialized_host();
+    return host == "localhost"sv || host.ends_with_bytes(".localhost"sv) || host == "127.0.0.1"sv || host == "[::1]"sv;
+}
+
+using StructuredFieldValue = Variant<String, Vector<String>>;
+
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-a-string
+static Optional<String> parse_structured_field_string(GenericLexer& lexer)
+{
+    if (!lexer.consume_specific('"'))
+        return {};
+
+    StringBuilder builder;
+
+    while (!lexer.is_eof()) {
+        auto character = lexer.consume();
+
+        if (character == '\\') {
+            if (lexer.is_eof() || !lexer.next_is([](char c) { return c == '"' || c == '\\'; }))
+                return {};
+            builder.append(lexer.consume());
+        } else if (character == '"') {
+            return builder.to_string_without_validation();
+        } else if (character < 0x20 || character > 0x7e) {
+            return {};
+        } else {
+            builder.append(character);
+        }
+    }
+
+    return {};
+}
+
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-a-token
+static Optional<String> parse_structured_field_token(GenericLexer& lexer)
+{
+    if (!lexer.next_is([](char c) { return is_ascii_alpha(c) || c == '*'; }))
+        return {};
+
+    auto token = lexer.consume_while([](char c) {
+        return is_ascii_alphanumeric(c) || "!#$%&'*+-.^_`|~:/"sv.contains(c);
+    });
+    return String::from_utf8_without_validation(token.bytes());
+}
+
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-parameters
+static void skip_structured_field_parameters(GenericLexer& lexer)
+{
+    while (lexer.consume_specific(';')) {
+        lexer.ignore_while(is_ascii_space);
+        lexer.consume_while([](char c) { return is_ascii_lower_alpha(c) || is_ascii_digit(c) || "_-.*"sv.contains(c); });
+
+        if (lexer.consume_specific('=')) {
+            if (lexer.next_is('"'))
+                (void)parse_structured_field_string(lexer);
+            else
+                lexer.consume_while([](char c) { return c != ';' && c != ',' && c != ')' && !is_ascii_space(c); });
+        }
+    }
+}
+
+// Parses the subset of structured field dictionaries that Use-As-Dictionary needs, i.e. members whose values are
+// strings, tokens, or inner lists of strings. Parameters are ignored.
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-a-dictionary
+static Optional<HashMap<String, StructuredFieldValue>> parse_structured_field_dictionary(StringView input)
+{
+    HashMap<String, StructuredFieldValue> dictionary;
+
+    GenericLexer lexer { input.trim_whitespace() };
+
+    while (!lexer.is_eof()) {
+        auto key = lexer.consume_while([](char c) { return is_ascii_lower_alpha(c) || is_ascii_digit(c) || "_-.*"sv.contains(c); });
+        if (key.is_empty())
+            return {};
+
+        StructuredFieldValue value = Vector<String> {};
+
+        if (lexer.consume_specific('=')) {
+            if (lexer.consume_specific('(')) {
+                Vector<String> items;
+
+                while (true) {
+                    lexer.ignore_while(is_ascii_space);
+                    if (lexer.consume_specific(')'))
+                        break;
+
+                    auto item = parse_structured_field_string(lexer);
+                    if (!item.has_value())
+                        return {};
+                    skip_structured_field_parameters(lexer);
+
+                    items.append(item.release_value());
+                }
+
+                value = move(items);
+            } else if (auto string = parse_structured_field_string(lexer); string.has_value()) {
+                value = string.release_value();
+            } else if (auto token = parse_structured_field_token(lexer); token.has_value()) {
+                value = token.release_value();
+            } else {
+                return {};
+            }
+        }
+
+        skip_structured_field_parameters(lexer);
+        dictionary.set(String::from_utf8_without_validation(key.bytes()), move(value));
+
+        lexer.ignore_while(is_ascii_space);
+        if (lexer.is_eof())
+            break;
+        if (!lexer.consume_specific(','))
+            return {};
+        lexer.ignore_while(is_ascii_space);
+    }
+
+    return dictionary;
+}
+
+// https://www.rfc-editor.org/rfc/rfc9842#name-dictionary-freshness-requirement
+static Optional<AK::Duration> freshness_lifetime(HTTP::HeaderMap const& headers)
+{
+    // FIXME: Take the Expires and Age headers into account.
+    auto cache_control = headers.get("Cache-Control"sv);
+    if (!cache_control.has_value())
+        return {};
+
+    Optional<AK::Duration> lifetime;
+
+    for (auto directive : cache_control->split_view(',')) {
+        directive = directive.trim_whitespace();
+
+        if (directive.equals_ignoring_ascii_case("no-store"sv))
+            return {};
+
+        if (directive.starts_with("max-age="sv, CaseSensitivity::CaseInsensitive)) {
+            if (auto seconds = directive.substring_view("max-age="sv.length()).to_number<u32>(); seconds.has_value())
+                lifetime = AK::Duration::from_seconds(*seconds);
+        }
+    }
+
+    return lifetime;
+}
+
+RefPtr<CompressionDictionaryStore::Dictionary const> CompressionDictionaryStore::find_dictionary_for_request(String const& partition, URL::URL const& url, Optional<StringView> destination)
+{
+    if (!may_use_dictionaries_for(url))
+        return {};
+
+    remove_expired_dictionaries();
+
+    auto origin = url.origin().serialize();
+    RefPtr<Dictionary const> best_dictionary;
+
+    for (auto const& dictionary : m_dictionaries) {
+        if (dictionary->partition != partition || dictionary->origin != origin)
+            continue;
+
+        if (!dictionary->match_destinations.is_empty()) {
+            if (!destination.has_value() || !dictionary->match_destinations.contains_slow(*destination))
+                continue;
+        }
+
+        auto result = dictionary->pattern.match(url, {});
+        if (result.is_error() || !result.value().has_value())
+            continue;
+
+        // https://www.rfc-editor.org/rfc/rfc9842#name-multiple-matching-dictionar
+        // The dictionary with the longest match wins. If there are several, the most recently fetched one wins, and we
+        // keep the dictionaries in the order in which they were fetched.
+        if (!best_dictionary || dictionary->match.byte_count() >= best_dictionary->match.byte_count())
+            best_dictionary = dictionary;
+    }
+
+    return best_dictionary;
+}
+
+// https://www.rfc-editor.org/rfc/rfc9842#name-use-as-dictionary
+Optional<CompressionDictionaryStore::UseAsDictionary> CompressionDictionaryStore::parse_use_as_dictionary(StringView header)
+{
+    auto members = parse_structured_field_dictionary(header);
+    if (!members.has_value())
+        return {};
+
+    auto get_string = [&](StringView key) -> Optional<String> {
+        if (auto value = members->get(key); value.has_value() && value->has<String>())
+            return value->get<String>();
+        return {};
+    };
+
+    UseAsDictionary result;
+
+    // The match member is required.
+    auto match = get_string("match"sv);
+    if (!match.has_value())
+        return {};
+    result.match = match.release_value();
+
+    // Only raw dictionaries are supported.
+    if (auto type = get_string("type"sv); type.has_value() && *type != "raw"sv)
+        return {};
+
+    if (auto match_destinations = members->get("match-dest"sv); match_destinations.has_value()) {
+        if (!match_destinations->has<Vector<String>>())
+            return {};
+        result.match_destinations = match_destinations->get<Vector<String>>();
+    }
+
+    if (auto id = get_string("id"sv); id.has_value()) {
+        if (id->byte_count() > maximum_dictionary_id_length)
+            return {};
+        result.id = id.release_value();
+    }
+
+    return result;
+}
+
+void CompressionDictionaryStore::store_dictionary_if_needed(String const& partition, URL::URL const& url, HTTP::HeaderMap const& response_headers, ReadonlyBytes body)
+{
+    auto use_as_dictionary_header = response_headers.get("Use-As-Dictionary"sv);
+    if (!use_as_dictionary_header.has_value() || !may_use_dictionaries_for(url))
+        return;
+
+    if (body.is_empty() || body.size() > maximum_dictionary_size)
+        return;
+
+    auto lifetime = freshness_lifetime(response_headers);
+    if (!lifetime.has_value() || lifetime->is_zero())
+        return;
+
+    auto use_as_dictionary = parse_use_as_dictionary(*use_as_dictionary_header);
+    if (!use_as_dictionary.has_value())
+        return;
+
+    // The match member has to be a valid URL pattern without regular expressions.
+    auto pattern = URL::Pattern::Pattern::create(use_as_dictionary->match, url.to_string());
+    if (pattern.is_error() || pattern.value().has_regexp_groups())
+        return;
+
+    auto dictionary = adopt_ref(*new Dictionary(partition, url, url.origin().serialize(), move(use_as_dictionary->match), pattern.release_value()));
+    dictionary->match_destinations = move(use_as_dictionary->match_destinations);
+    dictionary->id = move(use_as_dictionary->id);
+
+    auto content = ByteBuffer::copy(body);
+    if (content.is_error())
+        return;
+
+    dictionary->content = content.release_value();
+    dictionary->hash = Crypto::Hash::SHA256::hash(dictionary->content);
+    dictionary->expiration_time = UnixDateTime::now() + *lifetime;
+
+    // A newer response for the same URL replaces the dictionary we had for it.
+    m_dictionaries.remove_all_matching([&](auto const& existing_dictionary) {
+        if (existing_dictionary->partition != partition || existing_dictionary->url != url)
+            return false;
+        m_total_size -= existing_dictionary->content.size();
+        return true;
+    });
+
+    m_total_size += dictionary->content.size();
+    m_dictionaries.append(move(dictionary));
+
+    // Make room by evicting the least recently fetched dictionaries.
+    while (m_total_size > maximum_total_dictionary_size) {
+        auto evicted_dictionary = m_dictionaries.take_first();
+        m_total_size -= evicted_dictionary->content.size();
+    }
+}
+
+void CompressionDictionaryStore::clear()
+{
+    m_dictionaries.clear();
+    m_total_size = 0;
+}
+
+void CompressionDictionaryStore::remove_expired_dictionaries()
+{
+    auto now = UnixDateTime::now();
+
+    m_dictionaries.remove_all_matching([&](auto const& dictionary) {
+        if (dictionary->expiration_time > now)
+            return false;
+        m_total_size -= dictionary->content.size();
+        return true;
+    });
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibURL/Pattern/Pattern.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// Responses that the server marked as usable as a dictionary for compressing later responses, so that we may download
+// only the differences to them, e.g. when a new version of a script bundle is released.
+//
+// Dictionaries are partitioned like the HTTP cache, i.e. by the top-level site of the requests that fetched them, so
+// that one site can't use them to tell whether another site was visited.
+// https://www.rfc-editor.org/rfc/rfc9842
+class CompressionDictionaryStore {
+public:
+    struct Dictionary : public RefCounted<Dictionary> {
+        Dictionary(String partition, URL::URL url, String origin, String match, URL::Pattern::Pattern pattern)
+            : partition(move(partition))
+            , url(move(url))
+            , origin(move(origin))
+            , match(move(match))
+            , pattern(move(pattern))
+        {
+        }
+
+        String partition;
+        URL::URL url;
+        String origin;
+
+        // The URL pattern that the URLs of the requests that the dictionary may be used for have to match.
+        String match;
+        URL::Pattern::Pattern pattern;
+
+        // If not empty, the request destinations that the dictionary may be used for.
+        Vector<String> match_destinations;
+
+        String id;
+        ByteBuffer content;
+        Crypto::Hash::SHA256::DigestType hash;
+        UnixDateTime expiration_time;
+    };
+
+    // Dictionaries are kept in memory, so we have to be careful about how much of it they occupy.
+    static constexpr size_t maximum_dictionary_size = 16 * MiB;
+    static constexpr size_t maximum_total_dictionary_size = 64 * MiB;
+
+    static CompressionDictionaryStore& the();
+
+    CompressionDictionaryStore() = default;
+
+    // https://www.rfc-editor.org/rfc/rfc9842#name-dictionary-usage
+    static bool may_use_dictionaries_for(URL::URL const&);
+
+    // The members of a Use-As-Dictionary response header that we support.
+    // https://www.rfc-editor.org/rfc/rfc9842#name-use-as-dictionary
+    struct UseAsDictionary {
+        String match;
+        Vector<String> match_destinations;
+        String id;
+    };
+    static Optional<UseAsDictionary> parse_use_as_dictionary(StringView);
+
+    // Finds the best matching dictionary to advertise for a request to the given URL, if any. The destination is the
+    // request's Sec-Fetch-Dest header, if it has one.
+    RefPtr<Dictionary const> find_dictionary_for_request(String const& partition, URL::URL const&, Optional<StringView> destination);
+
+    // Stores the response as a dictionary if its headers say that it may be used as one.
+    void store_dictionary_if_needed(String const& partition, URL::URL const&, HTTP::HeaderMap const& response_headers, ReadonlyBytes body);
+
+    // Drops all dictionaries, e.g. when the user clears their browsing data.
+    void clear();
+
+    size_t dictionary_count() const { return m_dictionaries.size(); }
+
+private:
+    void remove_expired_dictionaries();
+
+    Vector<NonnullRefPtr<Dictionary>> m_dictionaries;
+    size_t m_total_size { 0 };
+};
+
+}
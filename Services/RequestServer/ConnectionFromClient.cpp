@@ -7,21 +7,32 @@
 #include "WebSocketImplCurl.h"
 
 #include <AK/Badge.h>
+#include <AK/Base64.h>
 #include <AK/IDAllocator.h>
 #include <AK/NonnullOwnPtr.h>
+#include <LibCompress/Brotli.h>
+#include <LibCompress/Gzip.h>
+#include <LibCompress/Zlib.h>
+#include <LibCompress/Zstd.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Proxy.h>
+#include <LibCore/SharedRingBuffer.h>
 #include <LibCore/Socket.h>
 #include <LibCore/StandardPaths.h>
+#include <LibCore/Timer.h>
 #include <LibRequests/NetworkError.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibRequests/RequestTimingInfo.h>
 #include <LibRequests/WebSocket.h>
 #include <LibTLS/TLSv12.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
+#include <RequestServer/CompressionDictionaryStore.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/ConnectionStatistics.h>
+#include <RequestServer/NetworkArchive.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #ifdef AK_OS_WINDOWS
 // needed because curl.h includes winsock2.h
@@ -35,6 +46,47 @@ ByteString g_default_certificate_path;
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 static long s_connect_timeout_seconds = 90L;
+
+// Responses at least this large have their body streamed through a shared memory ring rather than through a pipe.
+static constexpr u64 minimum_response_size_for_response_ring = 1 * MiB;
+static constexpr size_t response_ring_capacity = 1 * MiB;
+
+// Once this much of a response is queued up for a client that isn't keeping up with it, we stop receiving the response
+// until the client has caught up.
+static constexpr size_t maximum_queued_response_size = 4 * MiB;
+
+// The HTTP version of the last response from each origin, which tells us whether the origin makes use of the Priority
+// header. Once there are too many origins, we start over rather than keeping track of when each one was last used.
+static HashMap<String, Requests::ALPNHttpVersion> s_http_version_by_origin;
+static constexpr size_t maximum_origins_with_known_http_version = 1024;
+
+// How often a response body that is replayed from the network archive with limited bandwidth is delivered.
+static constexpr int replay_interval_ms = 10;
+
+// Dictionary-compressed responses start with one of these, followed by the SHA-256 hash of the dictionary.
+// https://www.rfc-editor.org/rfc/rfc9842#name-dictionary-compressed-brotl
+static constexpr Array<u8, 4> dictionary_compressed_brotli_magic { 0xff, 0x44, 0x43, 0x42 };
+// https://www.rfc-editor.org/rfc/rfc9842#name-dictionary-compressed-zstan
+static constexpr Array<u8, 8> dictionary_compressed_zstd_magic { 0x5e, 0x2a, 0x4d, 0x18, 0x20, 0x00, 0x00, 0x00 };
+
+// The encoded data of a response that we decode ourselves. As it arrives bit by bit, running out of it doesn't mean
+// that the response has ended, so we only report the end of the stream once curl has delivered all of it.
+class EncodedResponseStream final : public Stream {
+public:
+    bool has_buffered_data() const { return !m_data.is_eof(); }
+    void did_receive_all_data() { m_has_received_all_data = true; }
+
+    virtual ErrorOr<Bytes> read_some(Bytes bytes) override { return m_data.read_some(bytes); }
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes bytes) override { return m_data.write_some(bytes); }
+    virtual bool is_eof() const override { return m_has_received_all_data && m_data.is_eof(); }
+    virtual bool is_open() const override { return true; }
+    virtual void close() override { }
+
+private:
+    AllocatingMemoryStream m_data;
+    bool m_has_received_all_data { false };
+};
+
 static struct {
     Optional<Core::SocketAddress> server_address;
     Optional<ByteString> server_hostname;
@@ -107,16 +159,70 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     i32 request_id { 0 };
     WeakPtr<ConnectionFromClient> client;
     int writer_fd { 0 };
+    ByteString method;
+    String origin;
     HTTP::HeaderMap headers;
     bool got_all_headers { false };
     bool is_connect_only { false };
     size_t downloaded_so_far { 0 };
     String url;
     Optional<String> reason_phrase;
-    ByteBuffer body;
+    IPC::LargeBytes body;
     AllocatingMemoryStream send_buffer;
     NonnullRefPtr<Core::Notifier> write_notifier;
     bool done_fetching { false };
+    bool is_receiving_paused { false };
+
+    // The time it took us to resolve the host before handing the request to curl.
+    AK::Duration domain_lookup_time;
+
+    Optional<Core::SharedRingBuffer> response_ring;
+    int response_ring_wake_up_fd { -1 };
+    RefPtr<Core::Notifier> response_ring_wake_up_notifier;
+
+    // The response body, kept while the response is being recorded into the network archive.
+    ByteBuffer recorded_body;
+
+    // Set if the response may be stored as a compression dictionary.
+    Optional<URL::URL> dictionary_url;
+    String dictionary_partition;
+    bool should_keep_body_for_dictionary { false };
+    ByteBuffer dictionary_body;
+
+    // The compression dictionary we advertised to the server, if any. As curl doesn't know about dictionary-compressed
+    // responses, we don't let it decode such requests' responses, but decode them ourselves.
+    RefPtr<CompressionDictionaryStore::Dictionary const> available_dictionary;
+
+    enum class ContentEncoding {
+        Identity,
+        Gzip,
+        Deflate,
+        Brotli,
+        Zstd,
+        DictionaryCompressedBrotli,
+        DictionaryCompressedZstd,
+    };
+    ContentEncoding content_encoding { ContentEncoding::Identity };
+    ByteBuffer dictionary_compressed_response_header;
+    bool has_received_encoded_data { false };
+    bool has_content_encoding_error { false };
+
+    // When the client falls behind on a response we decode ourselves, we may pause the transfer after having taken
+    // the bytes curl handed us. curl delivers them again once it is resumed, at which point they have to be skipped.
+    size_t encoded_bytes_to_skip { 0 };
+
+    // NOTE: The decoder reads from the encoded response data, so the latter has to outlive the former.
+    EncodedResponseStream encoded_response_data;
+    OwnPtr<Stream> content_decoder;
+
+    // The state of a response that is being replayed from the network archive rather than received through curl.
+    NetworkArchive::Entry const* replayed_entry { nullptr };
+    ReadonlyBytes replayed_body;
+    AK::Duration replay_latency;
+    Optional<u64> replay_bandwidth;
+    MonotonicTime replay_start_time { MonotonicTime::now_coarse() };
+    RefPtr<Core::Timer> replay_latency_timer;
+    RefPtr<Core::Timer> replay_body_timer;
 
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
         : multi(multi)
@@ -144,8 +250,21 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         });
     }
 
+    ErrorOr<void> write_response_data(ReadonlyBytes bytes)
+    {
+        // OPTIMIZATION: If nothing is queued up, copy the data straight into the ring rather than via the send buffer.
+        if (response_ring.has_value() && send_buffer.is_eof())
+            bytes = bytes.slice(response_ring->write_some(bytes));
+
+        TRY(send_buffer.write_until_depleted(bytes));
+        return write_queued_bytes_without_blocking();
+    }
+
     ErrorOr<void> write_queued_bytes_without_blocking()
     {
+        if (response_ring.has_value())
+            return write_queued_bytes_to_response_ring();
+
         Vector<u8> bytes_to_send;
         bytes_to_send.resize(send_buffer.used_buffer_size());
         send_buffer.peek_some(bytes_to_send);
@@ -163,14 +282,141 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         if (send_buffer.is_eof() && done_fetching)
             schedule_self_destruction();
 
+        resume_receiving_if_needed();
+        return {};
+    }
+
+    ErrorOr<void> write_queued_bytes_to_response_ring()
+    {
+        while (true) {
+            for (auto destination = response_ring->writable_bytes(); !send_buffer.is_eof() && !destination.is_empty(); destination = response_ring->writable_bytes()) {
+                auto bytes_read = TRY(send_buffer.read_some(destination));
+                response_ring->did_write(bytes_read.size());
+            }
+
+            if (send_buffer.is_eof())
+                break;
+
+            // The ring is full, so ask the client to wake us up once it has made room. It may have done so in the
+            // meantime, in which case we have to try again, as it won't know that we're waiting.
+            response_ring->set_writer_waiting(true);
+            if (response_ring->writable_bytes().is_empty())
+                break;
+            response_ring->set_writer_waiting(false);
+        }
+
+        if (response_ring->take_reader_waiting()) {
+            // NOTE: If the pipe is full, the client has yet to read the wake-ups we sent before, so it will be woken up anyway.
+            u8 const wake_up = 0;
+            if (auto result = Core::System::write(writer_fd, { &wake_up, 1 }); result.is_error() && result.error().code() != EAGAIN)
+                return result.release_error();
+        }
+
+        if (send_buffer.is_eof() && done_fetching) {
+            response_ring->close_for_writing();
+            schedule_self_destruction();
+        }
+
+        resume_receiving_if_needed();
         return {};
     }
 
+    bool should_pause_receiving() const
+    {
+        return send_buffer.used_buffer_size() >= maximum_queued_response_size;
+    }
+
+    void resume_receiving_if_needed()
+    {
+        if (!is_receiving_paused || send_buffer.used_buffer_size() > maximum_queued_response_size / 2)
+            return;
+        is_receiving_paused = false;
+
+        // NOTE: curl may deliver the data it held back from within curl_easy_pause(), so don't unpause the transfer
+        //       while we're in the middle of writing out the response.
+        Core::deferred_invoke([weak_this = make_weak_ptr()] {
+            if (!weak_this)
+                return;
+            if (auto result = curl_easy_pause(weak_this->easy, CURLPAUSE_CONT); result != CURLE_OK)
+                dbgln("Warning: Unable to resume receiving the response: {}", curl_easy_strerror(result));
+        });
+    }
+
+    void set_up_response_ring_if_needed()
+    {
+        if (!should_use_response_ring())
+            return;
+
+        auto result = [&] -> ErrorOr<void> {
+            auto ring = TRY(Core::SharedRingBuffer::create(response_ring_capacity));
+            auto fds = TRY(Core::System::pipe2(O_NONBLOCK));
+
+            response_ring = move(ring);
+            response_ring_wake_up_fd = fds[0];
+            client->async_response_ring_available(request_id, response_ring->anonymous_buffer(), IPC::File::adopt_fd(fds[1]));
+            return {};
+        }();
+
+        if (result.is_error()) {
+            dbgln("Warning: Unable to set up a response ring, falling back to the request's pipe: {}", result.error());
+            return;
+        }
+
+        response_ring_wake_up_notifier = Core::Notifier::construct(response_ring_wake_up_fd, Core::NotificationType::Read);
+        response_ring_wake_up_notifier->on_activation = [this] {
+            u8 buffer[64];
+            while (true) {
+                auto result = Core::System::read(response_ring_wake_up_fd, buffer);
+                if (result.is_error())
+                    break;
+                if (result.value() == 0) {
+                    // The client has gone away, or it couldn't use the ring. Either way, nobody will read the rest of
+                    // the response, so fail the request rather than wait for room in the ring forever.
+                    response_ring_wake_up_notifier->set_enabled(false);
+                    did_lose_response_ring_reader();
+                    return;
+                }
+            }
+
+            if (auto maybe_error = write_queued_bytes_without_blocking(); maybe_error.is_error())
+                dbgln("Warning: Failed to write buffered request data to the response ring: {}", maybe_error.error());
+        };
+    }
+
+    void did_lose_response_ring_reader()
+    {
+        if (done_fetching && send_buffer.is_eof())
+            return;
+
+        if (client)
+            client->async_request_finished(request_id, downloaded_so_far, {}, Requests::NetworkError::Unknown);
+
+        // NOTE: Destroying the request removes it from curl's multi handle, so it will not be reported as finished again.
+        schedule_self_destruction();
+    }
+
+    bool should_use_response_ring() const
+    {
+        if (auto content_length = headers.get("Content-Length"sv); content_length.has_value()) {
+            if (auto size = content_length->to_number<u64>(); size.has_value() && *size >= minimum_response_size_for_response_ring)
+                return true;
+        }
+
+        // Media tends to be streamed for a long time, even when its size isn't known up front.
+        if (auto content_type = headers.get("Content-Type"sv); content_type.has_value())
+            return content_type->starts_with("audio/"sv, CaseSensitivity::CaseInsensitive) || content_type->starts_with("video/"sv, CaseSensitivity::CaseInsensitive);
+
+        return false;
+    }
+
     void notify_about_fetching_completion()
     {
         done_fetching = true;
-        if (send_buffer.is_eof())
+        if (send_buffer.is_eof()) {
+            if (response_ring.has_value())
+                response_ring->close_for_writing();
             schedule_self_destruction();
+        }
     }
 
     ~ActiveRequest()
@@ -182,9 +428,16 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         if (writer_fd > 0)
             MUST(Core::System::close(writer_fd));
 
-        auto result = curl_multi_remove_handle(multi, easy);
-        VERIFY(result == CURLM_OK);
-        curl_easy_cleanup(easy);
+        if (response_ring_wake_up_notifier)
+            response_ring_wake_up_notifier->close();
+        if (response_ring_wake_up_fd >= 0)
+            MUST(Core::System::close(response_ring_wake_up_fd));
+
+        if (easy) {
+            auto result = curl_multi_remove_handle(multi, easy);
+            VERIFY(result == CURLM_OK);
+            curl_easy_cleanup(easy);
+        }
 
         for (auto* string_list : curl_string_lists)
             curl_slist_free_all(string_list);
@@ -199,6 +452,253 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
         VERIFY(result == CURLE_OK);
         client->async_headers_became_available(request_id, headers, http_status_code, reason_phrase);
+        set_up_response_ring_if_needed();
+
+        should_keep_body_for_dictionary = dictionary_url.has_value() && http_status_code == 200 && headers.contains("Use-As-Dictionary"sv);
+
+        if (available_dictionary)
+            set_up_content_decoding();
+    }
+
+    void set_up_content_decoding()
+    {
+        auto header = headers.get("Content-Encoding"sv);
+        if (!header.has_value())
+            return;
+
+        auto encoding = header->trim_whitespace();
+
+        auto result = [&] -> ErrorOr<void> {
+            auto input = MaybeOwned<Stream> { encoded_response_data };
+
+            // NOTE: curl doesn't decode responses for which we advertised a dictionary, so we have to handle every
+            //       encoding a server might send, even if we didn't offer it.
+            if (encoding.equals_ignoring_ascii_case("gzip"sv) || encoding.equals_ignoring_ascii_case("x-gzip"sv)) {
+                content_encoding = ContentEncoding::Gzip;
+                content_decoder = TRY(Compress::GzipDecompressor::create(move(input)));
+            } else if (encoding.equals_ignoring_ascii_case("deflate"sv)) {
+                content_encoding = ContentEncoding::Deflate;
+                content_decoder = TRY(Compress::ZlibDecompressor::create(move(input)));
+            } else if (encoding.equals_ignoring_ascii_case("br"sv)) {
+                content_encoding = ContentEncoding::Brotli;
+                content_decoder = TRY(Compress::BrotliDecompressor::create(move(input)));
+            } else if (encoding.equals_ignoring_ascii_case("zstd"sv)) {
+                content_encoding = ContentEncoding::Zstd;
+                content_decoder = TRY(Compress::ZstdDecompressor::create(move(input)));
+            } else if (encoding.equals_ignoring_ascii_case("dcb"sv)) {
+                // NOTE: We can only create the decoder once we have received the dictionary-compressed response header.
+                content_encoding = ContentEncoding::DictionaryCompressedBrotli;
+            } else if (encoding.equals_ignoring_ascii_case("dcz"sv)) {
+                content_encoding = ContentEncoding::DictionaryCompressedZstd;
+            } else if (!encoding.is_empty() && !encoding.equals_ignoring_ascii_case("identity"sv)) {
+                return Error::from_string_literal("Unsupported content encoding");
+            }
+
+            return {};
+        }();
+
+        if (result.is_error()) {
+            dbgln("Warning: Unable to set up decoding of the {} response to {}: {}", encoding, url, result.error());
+            has_content_encoding_error = true;
+        }
+    }
+
+    ReadonlyBytes dictionary_compressed_magic() const
+    {
+        if (content_encoding == ContentEncoding::DictionaryCompressedBrotli)
+            return dictionary_compressed_brotli_magic;
+        if (content_encoding == ContentEncoding::DictionaryCompressedZstd)
+            return dictionary_compressed_zstd_magic;
+        return {};
+    }
+
+    ErrorOr<void> set_up_dictionary_content_decoder()
+    {
+        auto magic = dictionary_compressed_magic();
+        auto header = dictionary_compressed_response_header.bytes();
+
+        if (header.trim(magic.size()) != magic)
+            return Error::from_string_literal("Invalid dictionary-compressed response header");
+        if (header.slice(magic.size()) != available_dictionary->hash.bytes())
+            return Error::from_string_literal("Response was compressed with a dictionary we didn't advertise");
+
+        auto input = MaybeOwned<Stream> { encoded_response_data };
+
+        if (content_encoding == ContentEncoding::DictionaryCompressedBrotli)
+            content_decoder = TRY(Compress::BrotliDecompressor::create(move(input), available_dictionary->content));
+        else
+            content_decoder = TRY(Compress::ZstdDecompressor::create(move(input), available_dictionary->content));
+
+        return {};
+    }
+
+    ErrorOr<void> decode_response_data(ReadonlyBytes bytes)
+    {
+        auto bytes_to_skip = min(bytes.size(), encoded_bytes_to_skip);
+        encoded_bytes_to_skip -= bytes_to_skip;
+        bytes = bytes.slice(bytes_to_skip);
+
+        if (!bytes.is_empty())
+            has_received_encoded_data = true;
+        if (!has_received_encoded_data)
+            return {};
+
+        if (!content_decoder) {
+            if (bytes.is_empty())
+                return {};
+
+            auto header_size = dictionary_compressed_magic().size() + Crypto::Hash::SHA256::DigestType::Size;
+
+            auto header_bytes = bytes.trim(header_size - dictionary_compressed_response_header.size());
+            dictionary_compressed_response_header.append(header_bytes);
+            bytes = bytes.slice(header_bytes.size());
+
+            if (dictionary_compressed_response_header.size() < header_size)
+                return {};
+
+            if (auto result = set_up_dictionary_content_decoder(); result.is_error()) {
+                has_content_encoding_error = true;
+                return result.release_error();
+            }
+        }
+
+        TRY(encoded_response_data.write_until_depleted(bytes));
+
+        Array<u8, 16 * KiB> buffer;
+
+        // NOTE: A small amount of encoded data may decode to a huge amount of output, so we stop once the client can't
+        //       keep up. Whatever is left in the decoder is picked up the next time we receive data.
+        while (!content_decoder->is_eof() && !should_pause_receiving()) {
+            auto decoded = content_decoder->read_some(buffer);
+            if (decoded.is_error()) {
+                has_content_encoding_error = true;
+                return decoded.release_error();
+            }
+
+            TRY(did_receive_response_data(decoded.value()));
+
+            // The decoder can't make any more progress until we receive more data.
+            if (decoded.value().size() < buffer.size() && !encoded_response_data.has_buffered_data())
+                break;
+        }
+
+        return {};
+    }
+
+    ErrorOr<void> finish_decoding_response_data()
+    {
+        if (content_encoding == ContentEncoding::Identity || !has_received_encoded_data)
+            return {};
+        if (!content_decoder)
+            return Error::from_string_literal("Dictionary-compressed response ended prematurely");
+
+        encoded_response_data.did_receive_all_data();
+        if (content_encoding == ContentEncoding::Zstd || content_encoding == ContentEncoding::DictionaryCompressedZstd)
+            static_cast<Compress::ZstdDecompressor&>(*content_decoder).did_receive_all_input();
+
+        Array<u8, 16 * KiB> buffer;
+
+        while (!content_decoder->is_eof()) {
+            auto decoded = TRY(content_decoder->read_some(buffer));
+            TRY(did_receive_response_data(decoded));
+        }
+
+        return {};
+    }
+
+    ErrorOr<void> did_receive_response_data(ReadonlyBytes bytes)
+    {
+        if (bytes.is_empty())
+            return {};
+
+        TRY(write_response_data(bytes));
+
+        if (g_network_archive && g_network_archive->is_recording())
+            recorded_body.append(bytes);
+
+        if (should_keep_body_for_dictionary) {
+            if (dictionary_body.size() + bytes.size() <= CompressionDictionaryStore::maximum_dictionary_size) {
+                dictionary_body.append(bytes);
+            } else {
+                should_keep_body_for_dictionary = false;
+                dictionary_body.clear();
+            }
+        }
+
+        downloaded_so_far += bytes.size();
+        return {};
+    }
+
+    void record_into_network_archive(Requests::RequestTimingInfo const& timing_info)
+    {
+        long http_status_code = 0;
+        auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
+        VERIFY(result == CURLE_OK);
+
+        NetworkArchive::Entry entry {
+            .method = method,
+            .url = url,
+            .status_code = static_cast<u32>(http_status_code),
+            .reason_phrase = reason_phrase,
+            .headers = headers,
+            .body = move(recorded_body),
+            .time_to_first_byte = AK::Duration::from_microseconds(timing_info.response_start_microseconds),
+            .total_time = AK::Duration::from_microseconds(timing_info.response_end_microseconds),
+        };
+
+        if (auto maybe_error = g_network_archive->record(entry); maybe_error.is_error())
+            dbgln("Warning: Unable to record the response to {} {} into the network archive: {}", method, url, maybe_error.error());
+    }
+
+    void start_replaying(NetworkArchive::Entry const& entry)
+    {
+        replayed_entry = &entry;
+        replay_latency = g_network_archive->replay_options().latency.value_or(entry.time_to_first_byte);
+        replay_bandwidth = g_network_archive->bandwidth_for_replay(entry);
+        replay_start_time = MonotonicTime::now();
+
+        replay_body_timer = Core::Timer::create_repeating(replay_interval_ms, [this] { replay_next_chunk(); });
+
+        replay_latency_timer = Core::Timer::create_single_shot(static_cast<int>(replay_latency.to_milliseconds()), [this] {
+            headers = replayed_entry->headers;
+            reason_phrase = replayed_entry->reason_phrase;
+            got_all_headers = true;
+            client->async_headers_became_available(request_id, headers, replayed_entry->status_code, reason_phrase);
+            set_up_response_ring_if_needed();
+
+            replayed_body = replayed_entry->body;
+            replay_next_chunk();
+        });
+        replay_latency_timer->start();
+    }
+
+    void replay_next_chunk()
+    {
+        auto chunk_size = replay_bandwidth.has_value() ? max<size_t>(*replay_bandwidth * replay_interval_ms / 1000, 1) : replayed_body.size();
+
+        auto chunk = replayed_body.trim(chunk_size);
+        replayed_body = replayed_body.slice(chunk.size());
+
+        if (auto maybe_error = write_response_data(chunk); maybe_error.is_error())
+            dbgln("Warning: Failed to write replayed response data (it's likely the client disappeared): {}", maybe_error.error());
+        downloaded_so_far += chunk.size();
+
+        if (!replayed_body.is_empty()) {
+            if (!replay_body_timer->is_active())
+                replay_body_timer->start();
+            return;
+        }
+
+        replay_body_timer->stop();
+
+        Requests::RequestTimingInfo timing_info {
+            .response_start_microseconds = replay_latency.to_microseconds(),
+            .response_end_microseconds = (MonotonicTime::now() - replay_start_time).to_microseconds(),
+            .encoded_body_size = static_cast<long>(downloaded_so_far),
+        };
+
+        client->async_request_finished(request_id, downloaded_so_far, timing_info, {});
+        notify_about_fetching_completion();
     }
 };
 
@@ -242,17 +742,39 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     size_t total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
-    auto maybe_write_error = [&] -> ErrorOr<void> {
-        TRY(request->send_buffer.write_some(bytes));
-        return request->write_queued_bytes_without_blocking();
-    }();
+    // If the client isn't keeping up with the response, stop receiving it until it has caught up. curl will hand us
+    // these same bytes again once the transfer is resumed.
+    if (request->should_pause_receiving()) {
+        request->is_receiving_paused = true;
+        return CURL_WRITEFUNC_PAUSE;
+    }
+
+    if (request->has_content_encoding_error)
+        return CURL_WRITEFUNC_ERROR;
+
+    if (request->content_encoding != ActiveRequest::ContentEncoding::Identity) {
+        if (auto maybe_error = request->decode_response_data(bytes); maybe_error.is_error()) {
+            dbgln("ConnectionFromClient::on_data_received: Aborting request because error occurred whilst decoding the response: {}", maybe_error.error());
+            return CURL_WRITEFUNC_ERROR;
+        }
+
+        // If the decoder had more output than the client could take, hold the transfer back until it has caught up,
+        // so that the rest isn't decoded in one go once the transfer ends. We've taken these bytes already, though.
+        if (request->should_pause_receiving()) {
+            request->encoded_bytes_to_skip += total_size;
+            request->is_receiving_paused = true;
+            return CURL_WRITEFUNC_PAUSE;
+        }
+        return total_size;
+    }
+
+    auto maybe_write_error = request->did_receive_response_data(bytes);
 
     if (maybe_write_error.is_error()) {
         dbgln("ConnectionFromClient::on_data_received: Aborting request because error occurred whilst writing data to the client: {}", maybe_write_error.error());
         return CURL_WRITEFUNC_ERROR;
     }
 
-    request->downloaded_so_far += total_size;
     return total_size;
 }
 
@@ -429,22 +951,33 @@ void ConnectionFromClient::set_use_system_dns()
 }
 
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, IPC::LargeBytes, Core::ProxyData, Requests::RequestPriority, Optional<String>)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, IPC::LargeBytes request_body, Core::ProxyData proxy_data, Requests::RequestPriority priority, Optional<String> compression_dictionary_partition)
 {
+    if (!Requests::is_valid_request_priority(priority)) {
+        did_misbehave("StartRequest: Invalid request priority");
+        return;
+    }
+
+    if (g_network_archive && g_network_archive->is_replaying()) {
+        replay_request(request_id, method, url);
+        return;
+    }
+
     auto host = url.serialized_host().to_byte_string();
+    auto domain_lookup_start_time = MonotonicTime::now();
 
-    m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
+    m_resolver->dns.lookup_addresses(host, DNS::Messages::Class::IN, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
         ->when_rejected([this, request_id](auto const& error) {
             dbgln("StartRequest: DNS lookup failed: {}", error);
             // FIXME: Implement timing info for DNS lookup failure.
             async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, host = move(host), domain_lookup_start_time, url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, priority, compression_dictionary_partition = move(compression_dictionary_partition)](auto const& dns_result) mutable {
             if (dns_result->records().is_empty() || dns_result->cached_addresses().is_empty()) {
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
                 // FIXME: Implement timing info for DNS lookup failure.
@@ -455,12 +988,15 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             auto* easy = curl_easy_init();
             if (!easy) {
                 dbgln("StartRequest: Failed to initialize curl easy handle");
+                async_request_finished(request_id, 0, {}, Requests::NetworkError::Unknown);
                 return;
             }
 
             auto fds_or_error = Core::System::pipe2(O_NONBLOCK);
             if (fds_or_error.is_error()) {
                 dbgln("StartRequest: Failed to create pipe: {}", fds_or_error.error());
+                curl_easy_cleanup(easy);
+                async_request_finished(request_id, 0, {}, Requests::NetworkError::Unknown);
                 return;
             }
 
@@ -471,6 +1007,25 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
 
             auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
             request->url = url.to_string();
+            request->method = method;
+            request->origin = url.origin().serialize();
+            request->domain_lookup_time = MonotonicTime::now() - domain_lookup_start_time;
+
+            // NOTE: WebContent doesn't give us a partition for requests whose responses would be opaque to it, as
+            //       dictionaries must not be used for those.
+            if (method == "GET"sv && compression_dictionary_partition.has_value() && CompressionDictionaryStore::may_use_dictionaries_for(url)) {
+                request->dictionary_url = url;
+                request->dictionary_partition = compression_dictionary_partition.release_value();
+
+                // NOTE: If the request asks for particular encodings, e.g. because it is a range request, we leave it be.
+                if (!request_headers.contains("Accept-Encoding"sv) && !request_headers.contains("Range"sv)) {
+                    Optional<StringView> destination;
+                    if (auto header = request_headers.get("Sec-Fetch-Dest"sv); header.has_value())
+                        destination = header->view();
+
+                    request->available_dictionary = CompressionDictionaryStore::the().find_dictionary_for_request(request->dictionary_partition, url, destination);
+                }
+            }
 
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
@@ -486,11 +1041,13 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             if (!g_default_certificate_path.is_empty())
                 set_option(CURLOPT_CAINFO, g_default_certificate_path.characters());
 
-            set_option(CURLOPT_ACCEPT_ENCODING, ""); // empty string lets curl define the accepted encodings
+            if (!request->available_dictionary)
+                set_option(CURLOPT_ACCEPT_ENCODING, ""); // empty string lets curl define the accepted encodings
             set_option(CURLOPT_URL, url.to_string().to_byte_string().characters());
             set_option(CURLOPT_PORT, url.port_or_default());
             set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
             set_option(CURLOPT_PIPEWAIT, 1L);
+            set_option(CURLOPT_STREAM_WEIGHT, Requests::request_priority_to_http2_stream_weight(priority));
             set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path.characters());
 
             bool did_set_body = false;
@@ -500,7 +1057,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             } else if (method.is_one_of("POST"sv, "PUT"sv, "PATCH"sv, "DELETE"sv)) {
                 request->body = move(request_body);
                 set_option(CURLOPT_POSTFIELDSIZE, request->body.size());
-                set_option(CURLOPT_POSTFIELDS, request->body.data());
+                set_option(CURLOPT_POSTFIELDS, request->body.bytes().data());
                 did_set_body = true;
             } else if (method == "HEAD") {
                 set_option(CURLOPT_NOBODY, 1L);
@@ -533,6 +1090,31 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
                 curl_headers = curl_slist_append(curl_headers, header_string.characters());
             }
 
+            // HTTP/3 has no stream weights. Instead, servers which support extensible priorities read the urgency of the
+            // response from the Priority header. We only know which HTTP version the origin speaks once it has responded
+            // to us, and curl only switches to HTTP/3 once it has seen an Alt-Svc header in an earlier response anyway.
+            auto http_version = s_http_version_by_origin.get(request->origin).value_or(Requests::ALPNHttpVersion::None);
+            if (Requests::should_send_priority_header(priority, http_version) && !request_headers.contains("Priority")) {
+                auto header_string = ByteString::formatted("Priority: u={}", Requests::request_priority_to_urgency(priority));
+                curl_headers = curl_slist_append(curl_headers, header_string.characters());
+            }
+
+            // https://www.rfc-editor.org/rfc/rfc9842#name-available-dictionary
+            if (auto const& dictionary = request->available_dictionary) {
+                auto hash = MUST(encode_base64(dictionary->hash.bytes()));
+                auto header_string = ByteString::formatted("Available-Dictionary: :{}:", hash);
+                curl_headers = curl_slist_append(curl_headers, header_string.characters());
+
+                if (!dictionary->id.is_empty()) {
+                    auto id = dictionary->id.bytes_as_string_view().replace("\\"sv, "\\\\"sv, ReplaceMode::All).replace("\""sv, "\\\""sv, ReplaceMode::All);
+                    header_string = ByteString::formatted("Dictionary-ID: \"{}\"", id);
+                    curl_headers = curl_slist_append(curl_headers, header_string.characters());
+                }
+
+                // NOTE: We only offer the encodings we can decode ourselves.
+                curl_headers = curl_slist_append(curl_headers, "Accept-Encoding: dcb, dcz, br, zstd, gzip, deflate");
+            }
+
             if (curl_headers) {
                 set_option(CURLOPT_HTTPHEADER, curl_headers);
                 request->curl_string_lists.append(curl_headers);
@@ -560,6 +1142,37 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             m_active_requests.set(request_id, move(request));
         });
 }
+
+void ConnectionFromClient::replay_request(i32 request_id, ByteString const& method, URL::URL const& url)
+{
+    auto url_string = url.to_string();
+
+    auto const* entry = g_network_archive->find_entry_for_replay(method, url_string);
+    if (!entry) {
+        dbgln("ReplayRequest: No response to {} {} in the network archive", method, url_string);
+        async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToConnect);
+        return;
+    }
+
+    auto fds_or_error = Core::System::pipe2(O_NONBLOCK);
+    if (fds_or_error.is_error()) {
+        dbgln("ReplayRequest: Failed to create pipe: {}", fds_or_error.error());
+        async_request_finished(request_id, 0, {}, Requests::NetworkError::Unknown);
+        return;
+    }
+
+    auto fds = fds_or_error.release_value();
+    auto writer_fd = fds[1];
+    auto reader_fd = fds[0];
+    async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
+
+    auto request = make<ActiveRequest>(*this, m_curl_multi, nullptr, request_id, writer_fd);
+    request->url = move(url_string);
+    request->method = method;
+    request->start_replaying(*entry);
+
+    m_active_requests.set(request_id, move(request));
+}
 #endif
 
 static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& code)
@@ -588,7 +1201,7 @@ static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& cod
     }
 }
 
-static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* easy_handle)
+static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* easy_handle, AK::Duration time_before_transfer)
 {
     /*
      *   curl_easy_perform()
@@ -643,15 +1256,21 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
         break;
     }
 
+    // NOTE: We resolve the host ourselves before handing the request to curl, so the name lookup curl reports is nearly
+    //       instantaneous, and all of its times are relative to the end of our lookup. Any time the request then spends
+    //       queued up in curl, e.g. waiting for a connection to become available, lies between the end of the lookup
+    //       and the start of the connection.
+    auto transfer_start = time_before_transfer.to_microseconds();
+
     return Requests::RequestTimingInfo {
-        .domain_lookup_start_microseconds = queue_time,
-        .domain_lookup_end_microseconds = queue_time + domain_lookup_time,
-        .connect_start_microseconds = queue_time + domain_lookup_time,
-        .connect_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time,
-        .secure_connect_start_microseconds = queue_time + domain_lookup_time + connect_time,
-        .request_start_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + request_start_time,
-        .response_start_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_start_time,
-        .response_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_end_time,
+        .domain_lookup_start_microseconds = 0,
+        .domain_lookup_end_microseconds = transfer_start,
+        .connect_start_microseconds = transfer_start + queue_time + domain_lookup_time,
+        .connect_end_microseconds = transfer_start + queue_time + domain_lookup_time + connect_time + secure_connect_time,
+        .secure_connect_start_microseconds = transfer_start + queue_time + domain_lookup_time + connect_time,
+        .request_start_microseconds = transfer_start + queue_time + domain_lookup_time + connect_time + secure_connect_time + request_start_time,
+        .response_start_microseconds = transfer_start + queue_time + domain_lookup_time + connect_time + secure_connect_time + response_start_time,
+        .response_end_microseconds = transfer_start + queue_time + domain_lookup_time + connect_time + secure_connect_time + response_end_time,
         .encoded_body_size = encoded_body_size,
         .http_version_alpn_identifier = http_version_alpn,
     };
@@ -684,7 +1303,7 @@ void ConnectionFromClient::check_active_requests()
         auto* request = static_cast<ActiveRequest*>(application_private);
 
         if (!request->is_connect_only) {
-            auto timing_info = get_timing_info_from_curl_easy_handle(msg->easy_handle);
+            auto timing_info = get_timing_info_from_curl_easy_handle(msg->easy_handle, request->domain_lookup_time);
             request->flush_headers_if_needed();
 
             auto result_code = msg->data.result;
@@ -696,6 +1315,16 @@ void ConnectionFromClient::check_active_requests()
             if (result_code == CURLE_RECV_ERROR && request->downloaded_so_far != 0 && !request->headers.contains("Content-Length"sv))
                 result_code = CURLE_OK;
 
+            // NOTE: If we decode the response ourselves, failing to do so surfaces from curl as a write error.
+            if (request->has_content_encoding_error) {
+                result_code = CURLE_BAD_CONTENT_ENCODING;
+            } else if (result_code == CURLE_OK) {
+                if (auto result = request->finish_decoding_response_data(); result.is_error()) {
+                    dbgln("ConnectionFromClient: Unable to decode the response to {}: {}", request->url, result.error());
+                    result_code = CURLE_BAD_CONTENT_ENCODING;
+                }
+            }
+
             Optional<Requests::NetworkError> network_error;
             bool const request_was_successful = result_code == CURLE_OK;
             if (!request_was_successful) {
@@ -708,12 +1337,78 @@ void ConnectionFromClient::check_active_requests()
             }
 
             async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
+            if (ConnectionStatistics::is_enabled())
+                record_connection_statistics(*request, timing_info);
+
+            if (timing_info.http_version_alpn_identifier != Requests::ALPNHttpVersion::None) {
+                if (s_http_version_by_origin.size() >= maximum_origins_with_known_http_version && !s_http_version_by_origin.contains(request->origin))
+                    s_http_version_by_origin.clear();
+                s_http_version_by_origin.set(request->origin, timing_info.http_version_alpn_identifier);
+            }
+
+            if (request_was_successful && g_network_archive && g_network_archive->is_recording())
+                request->record_into_network_archive(timing_info);
+
+            if (request_was_successful && request->should_keep_body_for_dictionary)
+                CompressionDictionaryStore::the().store_dictionary_if_needed(request->dictionary_partition, *request->dictionary_url, request->headers, request->dictionary_body);
         }
 
         request->notify_about_fetching_completion();
     }
 }
 
+void ConnectionFromClient::record_connection_statistics(ActiveRequest const& request, Requests::RequestTimingInfo const& timing_info)
+{
+    auto get_long_info = [](CURL* easy, CURLINFO option) {
+        long value = 0;
+        auto result = curl_easy_getinfo(easy, option, &value);
+        VERIFY(result == CURLE_OK);
+        return value;
+    };
+    auto get_offset_info = [](CURL* easy, CURLINFO option) {
+        curl_off_t value = 0;
+        auto result = curl_easy_getinfo(easy, option, &value);
+        VERIFY(result == CURLE_OK);
+        return value;
+    };
+
+    ConnectionStatistics::CompletedRequest statistics;
+    statistics.reused_connection = get_long_info(request.easy, CURLINFO_NUM_CONNECTS) == 0;
+    statistics.queue_time = AK::Duration::from_microseconds(get_offset_info(request.easy, CURLINFO_QUEUE_TIME_T));
+    statistics.alpn_protocol = Requests::alpn_http_version_to_fly_string(timing_info.http_version_alpn_identifier);
+    statistics.bytes_sent = get_long_info(request.easy, CURLINFO_REQUEST_SIZE) + get_offset_info(request.easy, CURLINFO_SIZE_UPLOAD_T);
+    statistics.bytes_received = get_long_info(request.easy, CURLINFO_HEADER_SIZE) + get_offset_info(request.easy, CURLINFO_SIZE_DOWNLOAD_T);
+
+    // NOTE: Both of these are measured from the start of the transfer, and the TLS handshake happens in between them.
+    auto connect_time = get_offset_info(request.easy, CURLINFO_CONNECT_TIME_T);
+    auto app_connect_time = get_offset_info(request.easy, CURLINFO_APPCONNECT_TIME_T);
+    if (!statistics.reused_connection && app_connect_time > connect_time)
+        statistics.tls_handshake_time = AK::Duration::from_microseconds(app_connect_time - connect_time);
+
+    // For HTTP/2 and HTTP/3, this tells us how many requests are multiplexed onto a single connection.
+    if (auto connection_id = get_offset_info(request.easy, CURLINFO_CONN_ID); connection_id >= 0) {
+        for (auto const& it : m_active_requests) {
+            auto const& other_request = *it.value;
+            if (&other_request == &request || !other_request.easy || other_request.is_connect_only || other_request.done_fetching)
+                continue;
+            if (get_offset_info(other_request.easy, CURLINFO_CONN_ID) == connection_id)
+                ++statistics.concurrent_requests_on_connection;
+        }
+    }
+
+    ConnectionStatistics::the().record_completed_request(request.origin, statistics);
+}
+
+Messages::RequestServer::ConnectionStatisticsResponse ConnectionFromClient::connection_statistics()
+{
+    return ConnectionStatistics::the().serialize_as_json();
+}
+
+void ConnectionFromClient::clear_compression_dictionaries()
+{
+    CompressionDictionaryStore::the().clear();
+}
+
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
 {
     auto request = m_active_requests.take(request_id);
@@ -725,6 +1420,25 @@ Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(
     return true;
 }
 
+void ConnectionFromClient::set_request_priority(i32 request_id, Requests::RequestPriority priority)
+{
+    if (!Requests::is_valid_request_priority(priority)) {
+        did_misbehave("SetRequestPriority: Invalid request priority");
+        return;
+    }
+
+    // NOTE: The request may not have started yet if it is still waiting on its DNS lookup, or may have already finished.
+    //       Responses that are replayed from the network archive don't have a priority.
+    auto request = m_active_requests.get(request_id);
+    if (!request.has_value() || !request.value()->easy)
+        return;
+
+    // NOTE: curl sends the new weight to the server the next time it writes to the HTTP/2 connection.
+    auto result = curl_easy_setopt(request.value()->easy, CURLOPT_STREAM_WEIGHT, Requests::request_priority_to_http2_stream_weight(priority));
+    if (result != CURLE_OK)
+        dbgln("SetRequestPriority: Failed to set curl option: {}", curl_easy_strerror(result));
+}
+
 Messages::RequestServer::SetCertificateResponse ConnectionFromClient::set_certificate(i32 request_id, ByteString certificate, ByteString key)
 {
     (void)request_id;
@@ -735,6 +1449,10 @@ Messages::RequestServer::SetCertificateResponse ConnectionFromClient::set_certif
 
 void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level)
 {
+    // NOTE: Responses replayed from the network archive don't need any connections.
+    if (g_network_archive && g_network_archive->is_replaying())
+        return;
+
     auto const url_string_value = url.to_string();
 
     if (cache_level == CacheLevel::CreateConnection) {
@@ -774,7 +1492,7 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
     }
 
     if (cache_level == CacheLevel::ResolveOnly) {
-        [[maybe_unused]] auto promise = m_resolver->dns.lookup(url.serialized_host().to_byte_string(), DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally });
+        [[maybe_unused]] auto promise = m_resolver->dns.lookup_addresses(url.serialized_host().to_byte_string(), DNS::Messages::Class::IN, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally });
         if constexpr (REQUESTSERVER_DEBUG) {
             Core::ElapsedTimer timer;
             timer.start();
@@ -791,7 +1509,7 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
 {
     auto host = url.serialized_host().to_byte_string();
 
-    m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA })
+    m_resolver->dns.lookup_addresses(host)
         ->when_rejected([this, websocket_id](auto const& error) {
             dbgln("WebSocketConnect: DNS lookup failed: {}", error);
             async_websocket_errored(websocket_id, static_cast<i32>(Requests::WebSocket::Error::CouldNotEstablishConnection));
@@ -837,10 +1555,19 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
         });
 }
 
-void ConnectionFromClient::websocket_send(i64 websocket_id, bool is_text, ByteBuffer data)
+void ConnectionFromClient::websocket_send(i64 websocket_id, bool is_text, IPC::LargeBytes data)
 {
-    if (auto connection = m_websockets.get(websocket_id).value_or({}); connection && connection->ready_state() == WebSocket::ReadyState::Open)
-        connection->send(WebSocket::Message { move(data), is_text });
+    auto connection = m_websockets.get(websocket_id).value_or({});
+    if (!connection || connection->ready_state() != WebSocket::ReadyState::Open)
+        return;
+
+    auto buffer = data.release_byte_buffer();
+    if (buffer.is_error()) {
+        dbgln("Unable to send a WebSocket message of {} bytes: {}", data.size(), buffer.error());
+        return;
+    }
+
+    connection->send(WebSocket::Message { buffer.release_value(), is_text });
 }
 
 void ConnectionFromClient::websocket_close(i64 websocket_id, u16 code, ByteString reason)
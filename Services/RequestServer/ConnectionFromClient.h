@@ -42,13 +42,16 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, IPC::LargeBytes, Core::ProxyData, Requests::RequestPriority, Optional<String>) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
+    virtual void set_request_priority(i32 request_id, Requests::RequestPriority) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
+    virtual void clear_compression_dictionaries() override;
+    virtual Messages::RequestServer::ConnectionStatisticsResponse connection_statistics() override;
 
     virtual void websocket_connect(i64 websocket_id, URL::URL, ByteString, Vector<ByteString>, Vector<ByteString>, HTTP::HeaderMap) override;
-    virtual void websocket_send(i64 websocket_id, bool, ByteBuffer) override;
+    virtual void websocket_send(i64 websocket_id, bool, IPC::LargeBytes) override;
     virtual void websocket_close(i64 websocket_id, u16, ByteString) override;
     virtual Messages::RequestServer::WebsocketSetCertificateResponse websocket_set_certificate(i64, ByteString, ByteString) override;
 
@@ -65,6 +68,8 @@ private:
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
 
     void check_active_requests();
+    void record_connection_statistics(ActiveRequest const&, Requests::RequestTimingInfo const&);
+    void replay_request(i32 request_id, ByteString const& method, URL::URL const& url);
     void* m_curl_multi { nullptr };
     RefPtr<Core::Timer> m_timer;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
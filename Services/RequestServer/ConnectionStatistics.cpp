@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <RequestServer/ConnectionStatistics.h>
+#include <signal.h>
+
+namespace RequestServer {
+
+bool ConnectionStatistics::s_enabled { false };
+
+void ConnectionStatistics::enable()
+{
+    if (s_enabled)
+        return;
+    s_enabled = true;
+
+#if !defined(AK_OS_WINDOWS)
+    Core::EventLoop::register_signal(SIGUSR2, [](int) {
+        if (auto path = the().dump(); path.is_error())
+            dbgln("Unable to dump connection statistics: {}", path.error());
+        else
+            dbgln("Dumped connection statistics to {}", path.value());
+    });
+#endif
+}
+
+ConnectionStatistics& ConnectionStatistics::the()
+{
+    static ConnectionStatistics statistics;
+    return statistics;
+}
+
+void ConnectionStatistics::DurationSummary::record(AK::Duration duration)
+{
+    ++count;
+    total += duration;
+    maximum = max(maximum, duration);
+}
+
+void ConnectionStatistics::record_completed_request(String const& origin, CompletedRequest const& request)
+{
+    if (m_origins.size() >= maximum_origin_count && !m_origins.contains(origin))
+        evict_least_requested_origin();
+
+    auto& statistics = m_origins.ensure(origin);
+
+    ++statistics.request_count;
+    if (request.reused_connection)
+        ++statistics.reused_connection_count;
+
+    statistics.bytes_sent += request.bytes_sent;
+    statistics.bytes_received += request.bytes_received;
+
+    statistics.queue_time.record(request.queue_time);
+    if (request.tls_handshake_time.has_value())
+        statistics.tls_handshake_time.record(*request.tls_handshake_time);
+
+    if (!request.alpn_protocol.is_empty())
+        ++statistics.alpn_protocols.ensure(request.alpn_protocol);
+
+    if (request.concurrent_requests_on_connection > 0) {
+        ++statistics.multiplexed_request_count;
+        statistics.total_concurrent_requests_on_connection += request.concurrent_requests_on_connection;
+        statistics.maximum_concurrent_requests_on_connection = max(statistics.maximum_concurrent_requests_on_connection, request.concurrent_requests_on_connection);
+    }
+}
+
+void ConnectionStatistics::evict_least_requested_origin()
+{
+    auto least_requested = m_origins.begin();
+    for (auto it = m_origins.begin(); it != m_origins.end(); ++it) {
+        if (it->value.request_count < least_requested->value.request_count)
+            least_requested = it;
+    }
+
+    m_origins.remove(least_requested);
+    ++m_evicted_origin_count;
+}
+
+static JsonObject serialize_duration_summary(auto const& summary)
+{
+    JsonObject object;
+    object.set("count"sv, summary.count);
+    object.set("total_us"sv, summary.total.to_microseconds());
+    object.set("max_us"sv, summary.maximum.to_microseconds());
+    return object;
+}
+
+ByteString ConnectionStatistics::serialize_as_json() const
+{
+    JsonObject origins;
+
+    for (auto const& [origin, statistics] : m_origins) {
+        JsonObject alpn_protocols;
+        for (auto const& [protocol, count] : statistics.alpn_protocols)
+            alpn_protocols.set(protocol, count);
+
+        JsonObject object;
+        object.set("request_count"sv, statistics.request_count);
+        object.set("reused_connection_count"sv, statistics.reused_connection_count);
+        object.set("bytes_sent"sv, statistics.bytes_sent);
+        object.set("bytes_received"sv, statistics.bytes_received);
+        object.set("queue_time"sv, serialize_duration_summary(statistics.queue_time));
+        if (statistics.tls_handshake_time.count > 0)
+            object.set("tls_handshake_time"sv, serialize_duration_summary(statistics.tls_handshake_time));
+        object.set("alpn_protocols"sv, move(alpn_protocols));
+        object.set("multiplexed_request_count"sv, statistics.multiplexed_request_count);
+        object.set("total_concurrent_requests_on_connection"sv, statistics.total_concurrent_requests_on_connection);
+        object.set("max_concurrent_requests_on_connection"sv, statistics.maximum_concurrent_requests_on_connection);
+
+        origins.set(origin, move(object));
+    }
+
+    JsonObject object;
+    object.set("pid"sv, Core::System::getpid());
+    object.set("origins"sv, move(origins));
+    object.set("evicted_origin_count"sv, m_evicted_origin_count);
+
+    return object.serialized().to_byte_string();
+}
+
+ErrorOr<ByteString> ConnectionStatistics::dump() const
+{
+    auto path = ByteString::formatted("{}/connection-statistics-{}.json", Core::StandardPaths::tempfile_directory(), Core::System::getpid());
+
+    auto json = serialize_as_json();
+
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(json.bytes()));
+
+    return path;
+}
+
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+
+namespace RequestServer {
+
+// Aggregates connection-level metrics of the requests made by this process per origin, e.g. to tune connection limits
+// and pool sizes. The statistics can be queried over IPC, and are dumped as JSON whenever the process receives SIGUSR2.
+// Recording is disabled by default, and all call sites are expected to check is_enabled() before doing any work.
+class ConnectionStatistics {
+public:
+    // Once this many origins are tracked, the origin with the fewest requests makes room for a new one.
+    static constexpr size_t maximum_origin_count = 1000;
+
+    static bool is_enabled() { return s_enabled; }
+
+    // Enables recording, and dumps the statistics collected so far whenever the process receives SIGUSR2. This must be
+    // called after the main event loop has been created.
+    static void enable();
+
+    static ConnectionStatistics& the();
+
+    ConnectionStatistics() = default;
+
+    struct CompletedRequest {
+        bool reused_connection { false };
+        AK::Duration queue_time;
+        Optional<AK::Duration> tls_handshake_time;
+        FlyString alpn_protocol;
+        u64 bytes_sent { 0 };
+        u64 bytes_received { 0 };
+
+        // The number of other requests that were in flight on the same connection when this one completed.
+        size_t concurrent_requests_on_connection { 0 };
+    };
+
+    void record_completed_request(String const& origin, CompletedRequest const&);
+
+    ByteString serialize_as_json() const;
+
+    // Writes the statistics to a JSON file in the temporary directory, and returns its path.
+    ErrorOr<ByteString> dump() const;
+
+    size_t origin_count() const { return m_origins.size(); }
+
+private:
+    struct DurationSummary {
+        void record(AK::Duration);
+
+        u64 count { 0 };
+        AK::Duration total;
+        AK::Duration maximum;
+    };
+
+    struct OriginStatistics {
+        u64 request_count { 0 };
+        u64 reused_connection_count { 0 };
+        u64 bytes_sent { 0 };
+        u64 bytes_received { 0 };
+        DurationSummary queue_time;
+        DurationSummary tls_handshake_time;
+        HashMap<FlyString, u64> alpn_protocols;
+
+        u64 multiplexed_request_count { 0 };
+        u64 total_concurrent_requests_on_connection { 0 };
+        size_t maximum_concurrent_requests_on_connection { 0 };
+    };
+
+    void evict_least_requested_origin();
+
+    HashMap<String, OriginStatistics> m_origins;
+    u64 m_evicted_origin_count { 0 };
+
+    static bool s_enabled;
+};
+
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Base64.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibCore/File.h>
+#include <RequestServer/NetworkArchive.h>
+
+namespace RequestServer {
+
+OwnPtr<NetworkArchive> g_network_archive;
+
+static constexpr auto method_key = "method"sv;
+static constexpr auto url_key = "url"sv;
+static constexpr auto status_code_key = "statusCode"sv;
+static constexpr auto reason_phrase_key = "reasonPhrase"sv;
+static constexpr auto headers_key = "headers"sv;
+static constexpr auto body_key = "body"sv;
+static constexpr auto time_to_first_byte_key = "timeToFirstByteMicroseconds"sv;
+static constexpr auto total_time_key = "totalTimeMicroseconds"sv;
+
+static ByteString key_for_request(StringView method, StringView url)
+{
+    return ByteString::formatted("{} {}", method, url);
+}
+
+static ErrorOr<JsonObject> serialize_entry(NetworkArchive::Entry const& entry)
+{
+    JsonArray headers;
+    for (auto const& header : entry.headers.headers()) {
+        JsonArray name_and_value;
+        TRY(name_and_value.append(TRY(String::from_byte_string(header.name))));
+        TRY(name_and_value.append(TRY(String::from_byte_string(header.value))));
+        TRY(headers.append(move(name_and_value)));
+    }
+
+    JsonObject object;
+    object.set(method_key, TRY(String::from_byte_string(entry.method)));
+    object.set(url_key, entry.url);
+    object.set(status_code_key, entry.status_code);
+    if (entry.reason_phrase.has_value())
+        object.set(reason_phrase_key, *entry.reason_phrase);
+    object.set(headers_key, move(headers));
+    object.set(body_key, TRY(encode_base64(entry.body)));
+    object.set(time_to_first_byte_key, entry.time_to_first_byte.to_microseconds());
+    object.set(total_time_key, entry.total_time.to_microseconds());
+    return object;
+}
+
+static ErrorOr<NetworkArchive::Entry> parse_entry(JsonObject const& object)
+{
+    NetworkArchive::Entry entry;
+
+    auto method = object.get_string(method_key);
+    auto url = object.get_string(url_key);
+    auto status_code = object.get_u32(status_code_key);
+    if (!method.has_value() || !url.has_value() || !status_code.has_value())
+        return Error::from_string_literal("Network archive entry is missing its request or status code");
+
+    entry.method = method->to_byte_string();
+    entry.url = *url;
+    entry.status_code = *status_code;
+
+    if (auto reason_phrase = object.get_string(reason_phrase_key); reason_phrase.has_value())
+        entry.reason_phrase = *reason_phrase;
+
+    if (auto headers = object.get_array(headers_key); headers.has_value()) {
+        for (size_t i = 0; i < headers->size(); ++i) {
+            auto const& header = headers->at(i);
+            if (!header.is_array() || header.as_array().size() != 2 || !header.as_array()[0].is_string() || !header.as_array()[1].is_string())
+                return Error::from_string_literal("Network archive entry has a malformed header");
+
+            entry.headers.set(header.as_array()[0].as_string().to_byte_string(), header.as_array()[1].as_string().to_byte_string());
+        }
+    }
+
+    if (auto body = object.get_string(body_key); body.has_value())
+        entry.body = TRY(decode_base64(*body));
+
+    entry.time_to_first_byte = AK::Duration::from_microseconds(object.get_integer<i64>(time_to_first_byte_key).value_or(0));
+    entry.total_time = AK::Duration::from_microseconds(object.get_integer<i64>(total_time_key).value_or(0));
+
+    return entry;
+}
+
+ErrorOr<NonnullOwnPtr<NetworkArchive>> NetworkArchive::create_for_recording(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    return adopt_own(*new NetworkArchive(Mode::Record, move(file), {}));
+}
+
+ErrorOr<NonnullOwnPtr<NetworkArchive>> NetworkArchive::load_for_replay(StringView path, ReplayOptions replay_options)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    auto archive = adopt_own(*new NetworkArchive(Mode::Replay, nullptr, move(replay_options)));
+    size_t entry_count = 0;
+
+    for (auto line : StringView { contents }.lines()) {
+        if (line.is_whitespace())
+            continue;
+
+        auto json = TRY(JsonValue::from_string(line));
+        if (!json.is_object())
+            return Error::from_string_literal("Expected network archive entries to be JSON objects");
+
+        auto entry = TRY(parse_entry(json.as_object()));
+        auto key = key_for_request(entry.method, entry.url);
+
+        archive->m_recorded_responses.ensure(key).entries.append(move(entry));
+        ++entry_count;
+    }
+
+    dbgln("NetworkArchive: Loaded {} responses to {} requests from {}", entry_count, archive->m_recorded_responses.size(), path);
+    return archive;
+}
+
+NetworkArchive::NetworkArchive(Mode mode, OwnPtr<Core::File> file, ReplayOptions replay_options)
+    : m_mode(mode)
+    , m_file(move(file))
+    , m_replay_options(move(replay_options))
+{
+}
+
+NetworkArchive::~NetworkArchive() = default;
+
+ErrorOr<void> NetworkArchive::record(Entry const& entry)
+{
+    VERIFY(is_recording());
+
+    auto object = TRY(serialize_entry(entry));
+
+    // NOTE: Each entry is written out as soon as it is recorded, as RequestServer is usually killed rather than being
+    //       allowed to exit cleanly.
+    TRY(m_file->write_until_depleted(object.serialized()));
+    TRY(m_file->write_until_depleted("\n"sv));
+
+    return {};
+}
+
+NetworkArchive::Entry const* NetworkArchive::find_entry_for_replay(StringView method, StringView url)
+{
+    VERIFY(is_replaying());
+
+    auto it = m_recorded_responses.find(key_for_request(method, url));
+    if (it == m_recorded_responses.end())
+        return nullptr;
+
+    auto& [entries, next_entry_index] = it->value;
+    auto index = min(next_entry_index, entries.size() - 1);
+    ++next_entry_index;
+
+    return &entries[index];
+}
+
+Optional<u64> NetworkArchive::bandwidth_for_replay(Entry const& entry) const
+{
+    if (m_replay_options.bandwidth_in_bytes_per_second.has_value())
+        return m_replay_options.bandwidth_in_bytes_per_second;
+
+    auto transfer_time = entry.total_time - entry.time_to_first_byte;
+    if (entry.body.is_empty() || transfer_time <= AK::Duration::zero())
+        return {};
+
+    return max<u64>(entry.body.size() * 1'000'000 / transfer_time.to_microseconds(), 1);
+}
+
+}
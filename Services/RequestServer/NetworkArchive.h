@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibHTTP/HeaderMap.h>
+
+namespace RequestServer {
+
+// Stores the responses RequestServer receives, so that they can later be served again without any network access,
+// e.g. to benchmark page loads reproducibly. The archive is a JSON Lines file, with one response per line.
+class NetworkArchive {
+public:
+    enum class Mode {
+        Record,
+        Replay,
+    };
+
+    struct Entry {
+        ByteString method;
+        String url;
+        u32 status_code { 0 };
+        Optional<String> reason_phrase;
+        HTTP::HeaderMap headers;
+        ByteBuffer body;
+
+        // Relative to the start of the request.
+        AK::Duration time_to_first_byte;
+        AK::Duration total_time;
+    };
+
+    struct ReplayOptions {
+        // The time to wait before responding to a request. If not set, the time it originally took to receive the
+        // first byte of the response is used.
+        Optional<AK::Duration> latency;
+
+        // The rate at which response bodies are delivered. If not set, each body is delivered over the time it originally
+        // took to receive it.
+        Optional<u64> bandwidth_in_bytes_per_second;
+    };
+
+    static ErrorOr<NonnullOwnPtr<NetworkArchive>> create_for_recording(StringView path);
+    static ErrorOr<NonnullOwnPtr<NetworkArchive>> load_for_replay(StringView path, ReplayOptions);
+
+    ~NetworkArchive();
+
+    Mode mode() const { return m_mode; }
+    bool is_recording() const { return m_mode == Mode::Record; }
+    bool is_replaying() const { return m_mode == Mode::Replay; }
+
+    ReplayOptions const& replay_options() const { return m_replay_options; }
+
+    ErrorOr<void> record(Entry const&);
+
+    // Responses to the same request are served in the order in which they were recorded. Once they have all been
+    // served, the last one is served again.
+    Entry const* find_entry_for_replay(StringView method, StringView url);
+
+    // The rate at which the body of the given entry is to be delivered, or nothing if it is to be delivered at once.
+    Optional<u64> bandwidth_for_replay(Entry const&) const;
+
+private:
+    NetworkArchive(Mode, OwnPtr<Core::File>, ReplayOptions);
+
+    Mode m_mode { Mode::Record };
+    OwnPtr<Core::File> m_file;
+    ReplayOptions m_replay_options;
+
+    struct RecordedResponses {
+        Vector<Entry> entries;
+        size_t next_entry_index { 0 };
+    };
+    HashMap<ByteString, RecordedResponses> m_recorded_responses;
+};
+
+extern OwnPtr<NetworkArchive> g_network_archive;
+
+}
@@ -13,8 +13,11 @@
 #include <LibCore/EventLoop.h>
 #include <LibCore/Process.h>
 #include <LibIPC/SingleServer.h>
+#include <LibIPC/Statistics.h>
 #include <LibMain/Main.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/ConnectionStatistics.h>
+#include <RequestServer/NetworkArchive.h>
 
 #if defined(AK_OS_MACOS)
 #    include <LibCore/Platform/ProcessStatisticsMach.h>
@@ -33,11 +36,23 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     Vector<ByteString> certificates;
     StringView mach_server_name;
     bool wait_for_debugger = false;
+    bool enable_ipc_statistics = false;
+    bool enable_connection_statistics = false;
+    StringView record_network_path;
+    StringView replay_network_path;
+    Optional<u32> replay_latency_ms;
+    Optional<u64> replay_bandwidth;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
+    args_parser.add_option(enable_ipc_statistics, "Collect IPC statistics, dumped as JSON on SIGUSR1", "ipc-stats");
+    args_parser.add_option(enable_connection_statistics, "Collect connection statistics, dumped as JSON on SIGUSR2", "connection-stats");
+    args_parser.add_option(record_network_path, "Record all responses into a network archive", "record-network", 0, "path");
+    args_parser.add_option(replay_network_path, "Serve all responses from a network archive instead of the network", "replay-network", 0, "path");
+    args_parser.add_option(replay_latency_ms, "Latency of replayed responses (default: as recorded)", "replay-latency", 0, "milliseconds");
+    args_parser.add_option(replay_bandwidth, "Bandwidth of replayed responses (default: unlimited)", "replay-bandwidth", 0, "bytes-per-second");
     args_parser.parse(arguments);
 
     if (wait_for_debugger)
@@ -49,6 +64,23 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     Core::EventLoop event_loop;
 
+    if (enable_ipc_statistics)
+        IPC::Statistics::enable();
+
+    if (enable_connection_statistics)
+        RequestServer::ConnectionStatistics::enable();
+
+    if (!replay_network_path.is_empty()) {
+        RequestServer::NetworkArchive::ReplayOptions replay_options;
+        if (replay_latency_ms.has_value())
+            replay_options.latency = AK::Duration::from_milliseconds(*replay_latency_ms);
+        replay_options.bandwidth_in_bytes_per_second = replay_bandwidth;
+
+        RequestServer::g_network_archive = TRY(RequestServer::NetworkArchive::load_for_replay(replay_network_path, move(replay_options)));
+    } else if (!record_network_path.is_empty()) {
+        RequestServer::g_network_archive = TRY(RequestServer::NetworkArchive::create_for_recording(record_network_path));
+    }
+
 #if defined(AK_OS_MACOS)
     if (!mach_server_name.is_empty())
         Core::Platform::register_with_mach_server(mach_server_name);
@@ -12,12 +12,18 @@
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Profiler.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -360,6 +366,41 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "dump-shape-memory") {
+        JS::Shape::compute_memory_report(Web::Bindings::main_thread_vm().heap()).dump();
+        return;
+    }
+
+    if (request == "start-bytecode-profiling") {
+        Web::Bindings::main_thread_vm().bytecode_interpreter().set_profiling_enabled(true);
+        return;
+    }
+
+    if (request == "stop-bytecode-profiling") {
+        auto& interpreter = Web::Bindings::main_thread_vm().bytecode_interpreter();
+        if (auto* profiler = interpreter.profiler())
+            dbgln("{}", profiler->report());
+        interpreter.set_profiling_enabled(false);
+        return;
+    }
+
+    if (request == "start-tracing") {
+        Core::Tracing::start();
+        return;
+    }
+
+    if (request == "stop-tracing") {
+        auto path = argument.is_empty()
+            ? ByteString::formatted("{}/ladybird-trace-{}.json", Core::StandardPaths::tempfile_directory(), Core::System::getpid())
+            : argument;
+
+        if (auto result = Core::Tracing::stop_and_write_to_file(path); result.is_error())
+            warnln("Unable to write trace to {}: {}", path, result.error());
+        else
+            dbgln("Wrote trace to {}", path);
+        return;
+    }
+
     if (request == "set-line-box-borders") {
         bool state = argument == "on";
         auto traversable = page->page().top_level_traversable();
@@ -14,6 +14,7 @@
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/PathFontProvider.h>
 #include <LibIPC/ConnectionFromClient.h>
+#include <LibIPC/Statistics.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibMain/Main.h>
 #include <LibMedia/Audio/Loader.h>
@@ -66,6 +67,7 @@ extern bool g_enable_idl_tracing;
 namespace Web::Fetch::Fetching {
 
 extern bool g_http_cache_enabled;
+extern bool g_response_streaming_enabled;
 
 }
 
@@ -106,11 +108,13 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool disable_site_isolation = false;
     bool enable_idl_tracing = false;
     bool enable_http_cache = false;
+    bool enable_response_streaming = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
     bool is_headless = false;
     bool disable_scrollbar_painting = false;
+    bool enable_ipc_statistics = false;
     StringView echo_server_port_string_view {};
 
     Core::ArgsParser args_parser;
@@ -128,12 +132,14 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
+    args_parser.add_option(enable_response_streaming, "Stream HTTP(S) response bodies as they are received", "enable-response-streaming");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical viewport scrollbars", "disable-scrollbar-painting");
     args_parser.add_option(echo_server_port_string_view, "Echo server port used in test internals", "echo-server-port", 0, "echo_server_port");
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
+    args_parser.add_option(enable_ipc_statistics, "Collect IPC statistics, dumped as JSON on SIGUSR1", "ipc-stats");
 
     args_parser.parse(arguments);
 
@@ -141,6 +147,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         Core::Process::wait_for_debugger_and_break();
     }
 
+    if (enable_ipc_statistics)
+        IPC::Statistics::enable();
+
     auto& font_provider = static_cast<Gfx::PathFontProvider&>(Gfx::FontDatabase::the().install_system_font_provider(make<Gfx::PathFontProvider>()));
     if (force_fontconfig) {
         font_provider.set_name_but_fixme_should_create_custom_system_font_provider("FontConfig"_string);
@@ -168,6 +177,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         Web::Fetch::Fetching::g_http_cache_enabled = true;
     }
 
+    Web::Fetch::Fetching::g_response_streaming_enabled = enable_response_streaming;
+
     Web::Painting::g_paint_viewport_scrollbars = !disable_scrollbar_painting;
 
     if (!echo_server_port_string_view.is_empty()) {
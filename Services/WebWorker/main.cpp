@@ -10,6 +10,7 @@
 #include <LibCore/System.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibIPC/SingleServer.h>
+#include <LibIPC/Statistics.h>
 #include <LibMain/Main.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Loader/GeneratedPagesLoader.h>
@@ -47,6 +48,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     StringView worker_type_string;
     Vector<ByteString> certificates;
     bool wait_for_debugger = false;
+    bool enable_ipc_statistics = false;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(request_server_socket, "File descriptor of the request server socket", "request-server-socket", 's', "request-server-socket");
@@ -54,6 +56,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(serenity_resource_root, "Absolute path to directory for serenity resources", "serenity-resource-root", 'r', "serenity-resource-root");
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
+    args_parser.add_option(enable_ipc_statistics, "Collect IPC statistics, dumped as JSON on SIGUSR1", "ipc-stats");
     args_parser.add_option(worker_type_string, "Type of WebWorker to start (dedicated, shared, or service)", "type", 't', "type");
 
     args_parser.parse(arguments);
@@ -65,6 +68,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     Core::EventLoop event_loop;
 
+    if (enable_ipc_statistics)
+        IPC::Statistics::enable();
+
     WebView::platform_init();
 
     TRY(initialize_image_decoder(image_decoder_socket));
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MaybeOwned.h>
+#include <AK/MemoryStream.h>
+#include <LibCompress/Brotli.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(brotli_decompress_simple)
+{
+    Array<u8, 19> const compressed {
+        0x0B, 0x07, 0x80, 0x77, 0x6F, 0x72, 0x64, 0x31, 0x20, 0x61, 0x62, 0x63,
+        0x20, 0x77, 0x6F, 0x72, 0x64, 0x32, 0x03
+    };
+
+    auto decompressed = TRY_OR_FAIL(Compress::BrotliDecompressor::decompress_all(compressed));
+    EXPECT_EQ(StringView { decompressed }, "word1 abc word2"sv);
+}
+
+TEST_CASE(brotli_decompress_repeated)
+{
+    Array<u8, 13> const compressed {
+        0x1B, 0x2F, 0x00, 0xF8, 0x25, 0xC3, 0xC4, 0xC6, 0xC2, 0x9B, 0x20, 0xE0,
+        0x34
+    };
+
+    auto decompressed = TRY_OR_FAIL(Compress::BrotliDecompressor::decompress_all(compressed));
+    EXPECT_EQ(StringView { decompressed }, "abcabcabcabcabcabcabcabcabcabcabcabcabcabcabcabc"sv);
+}
+
+TEST_CASE(brotli_decompress_stream)
+{
+    Array<u8, 19> const compressed {
+        0x0B, 0x07, 0x80, 0x77, 0x6F, 0x72, 0x64, 0x31, 0x20, 0x61, 0x62, 0x63,
+        0x20, 0x77, 0x6F, 0x72, 0x64, 0x32, 0x03
+    };
+
+    auto stream = make<AllocatingMemoryStream>();
+    auto input = MaybeOwned<Stream> { *stream };
+    auto decompressor = TRY_OR_FAIL(Compress::BrotliDecompressor::create(move(input)));
+
+    // Feed the data in two parts to make sure the decompressor can make progress on partial input.
+    TRY_OR_FAIL(stream->write_until_depleted(compressed.span().trim(8)));
+
+    Array<u8, 32> buffer;
+    auto first_part = TRY_OR_FAIL(decompressor->read_some(buffer));
+    EXPECT(!decompressor->is_eof());
+
+    ByteBuffer decompressed;
+    decompressed.append(first_part);
+
+    TRY_OR_FAIL(stream->write_until_depleted(compressed.span().slice(8)));
+    decompressed.append(TRY_OR_FAIL(decompressor->read_until_eof()));
+
+    EXPECT_EQ(StringView { decompressed }, "word1 abc word2"sv);
+}
+
+TEST_CASE(brotli_decompress_truncated)
+{
+    Array<u8, 19> const compressed {
+        0x0B, 0x07, 0x80, 0x77, 0x6F, 0x72, 0x64, 0x31, 0x20, 0x61, 0x62, 0x63,
+        0x20, 0x77, 0x6F, 0x72, 0x64, 0x32, 0x03
+    };
+
+    auto decompressed = Compress::BrotliDecompressor::decompress_all(compressed.span().trim(10));
+    EXPECT(decompressed.is_error());
+}
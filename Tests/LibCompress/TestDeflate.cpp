@@ -11,6 +11,8 @@
 #include <LibCompress/Deflate.h>
 #include <LibTest/TestCase.h>
 
+#include <zlib.h>
+
 TEST_CASE(canonical_code_simple)
 {
     Array<u8, 32> const code {
@@ -149,6 +151,44 @@ TEST_CASE(deflate_round_trip_compress_large)
     EXPECT(uncompressed == original);
 }
 
+TEST_CASE(deflate_decompress_large_full_flush)
+{
+    // Large enough for the decompressor to split the work across multiple threads.
+    auto original = TRY_OR_FAIL(ByteBuffer::create_uninitialized(8 * MiB));
+    fill_with_random(original);
+
+    // Repeat parts of the data, so that the compressor emits back-references as well.
+    for (size_t offset = 1 * KiB; offset < original.size(); offset += 1 * KiB)
+        original.overwrite(offset, original.offset_pointer(offset - 1 * KiB + 100), 512);
+
+    z_stream stream {};
+    VERIFY(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+
+    ByteBuffer compressed;
+    Array<u8, 64 * KiB> buffer;
+
+    for (size_t offset = 0; offset < original.size();) {
+        auto chunk = original.bytes().slice(offset, min(128 * KiB, original.size() - offset));
+        offset += chunk.size();
+
+        stream.next_in = chunk.data();
+        stream.avail_in = chunk.size();
+
+        auto flush = offset == original.size() ? Z_FINISH : Z_FULL_FLUSH;
+        do {
+            stream.next_out = buffer.data();
+            stream.avail_out = buffer.size();
+            VERIFY(deflate(&stream, flush) != Z_STREAM_ERROR);
+            compressed.append(buffer.data(), buffer.size() - stream.avail_out);
+        } while (stream.avail_out == 0);
+    }
+
+    deflateEnd(&stream);
+
+    auto uncompressed = TRY_OR_FAIL(Compress::DeflateDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
+
 TEST_CASE(deflate_compress_literals)
 {
     // This byte array is known to not produce any back references with our lz77 implementation even at the highest compression settings
@@ -4,9 +4,76 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Format.h>
 #include <LibCompress/Gzip.h>
+#include <LibCompress/ParallelInflate.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibTest/TestCase.h>
 
+#include <zlib.h>
+
+// Large enough for the decompressor to split the work across multiple threads.
+static constexpr size_t large_input_size = 8 * MiB;
+
+static ByteBuffer make_text(size_t size)
+{
+    static constexpr Array words { "lorem "sv, "ipsum "sv, "dolor "sv, "sit "sv, "amet "sv, "consectetur "sv, "adipiscing "sv, "elit\n"sv };
+
+    ByteBuffer buffer;
+    u32 state = 1;
+
+    while (buffer.size() < size) {
+        state = state * 1103515245 + 12345;
+        buffer.append(words[(state >> 16) % words.size()].bytes());
+
+        // Sprinkle in some noise, so that the text doesn't compress too well.
+        buffer.append(static_cast<u8>(state >> 8));
+    }
+
+    buffer.resize(size);
+    return buffer;
+}
+
+// Compresses the input as a single gzip member, flushing the compressor every 128 KiB as pigz does.
+static ByteBuffer compress_with_flushes(ReadonlyBytes input, int flush)
+{
+    z_stream stream {};
+    VERIFY(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS | 16, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+
+    ByteBuffer output;
+    Array<u8, 64 * KiB> buffer;
+
+    for (size_t offset = 0; offset < input.size();) {
+        auto chunk = input.slice(offset, min(128 * KiB, input.size() - offset));
+        offset += chunk.size();
+
+        stream.next_in = const_cast<u8*>(chunk.data());
+        stream.avail_in = chunk.size();
+
+        auto chunk_flush = offset == input.size() ? Z_FINISH : flush;
+        do {
+            stream.next_out = buffer.data();
+            stream.avail_out = buffer.size();
+            VERIFY(deflate(&stream, chunk_flush) != Z_STREAM_ERROR);
+            output.append(buffer.data(), buffer.size() - stream.avail_out);
+        } while (stream.avail_out == 0);
+    }
+
+    deflateEnd(&stream);
+    return output;
+}
+
+static ByteBuffer compress_as_multiple_members(ReadonlyBytes input, size_t member_count)
+{
+    ByteBuffer output;
+    auto member_size = ceil_div(input.size(), member_count);
+
+    for (size_t offset = 0; offset < input.size(); offset += member_size)
+        output.append(MUST(Compress::GzipCompressor::compress_all(input.slice(offset, min(member_size, input.size() - offset)))));
+
+    return output;
+}
+
 TEST_CASE(gzip_decompress_simple)
 {
     Array<u8, 33> const compressed {
@@ -102,3 +169,91 @@ TEST_CASE(gzip_truncated_uncompressed_block)
     auto const decompressed_or_error = Compress::GzipDecompressor::decompress_all(compressed);
     EXPECT(decompressed_or_error.is_error());
 }
+
+TEST_CASE(gzip_decompress_large_multiple_members)
+{
+    auto original = make_text(large_input_size);
+    auto compressed = compress_as_multiple_members(original, 16);
+
+    auto decompressed = TRY_OR_FAIL(Compress::GzipDecompressor::decompress_all(compressed));
+    EXPECT(decompressed == original);
+}
+
+TEST_CASE(gzip_decompress_large_full_flush)
+{
+    auto original = make_text(large_input_size);
+    auto compressed = compress_with_flushes(original, Z_FULL_FLUSH);
+
+    auto decompressed = TRY_OR_FAIL(Compress::GzipDecompressor::decompress_all(compressed));
+    EXPECT(decompressed == original);
+}
+
+TEST_CASE(gzip_decompress_large_sync_flush)
+{
+    // A sync flush doesn't reset the compressor's window, so the data after it may refer back to the data before it.
+    auto original = make_text(large_input_size);
+    auto compressed = compress_with_flushes(original, Z_SYNC_FLUSH);
+
+    auto decompressed = TRY_OR_FAIL(Compress::GzipDecompressor::decompress_all(compressed));
+    EXPECT(decompressed == original);
+}
+
+TEST_CASE(gzip_decompress_large_in_parallel)
+{
+    // Make sure that the large inputs above are actually split, no matter how many cores this machine has.
+    static constexpr Compress::ParallelInflateOptions options { .maximum_range_count = 4 };
+    auto original = make_text(large_input_size);
+
+    auto decompressed = Compress::try_inflate_in_parallel(compress_as_multiple_members(original, 16), Compress::ParallelInflateFormat::Gzip, options);
+    EXPECT(decompressed.has_value());
+    EXPECT(decompressed == original);
+
+    decompressed = Compress::try_inflate_in_parallel(compress_with_flushes(original, Z_FULL_FLUSH), Compress::ParallelInflateFormat::Gzip, options);
+    EXPECT(decompressed.has_value());
+    EXPECT(decompressed == original);
+
+    // Sync flushed ranges depend on each other, so they are left to the sequential decoder.
+    decompressed = Compress::try_inflate_in_parallel(compress_with_flushes(original, Z_SYNC_FLUSH), Compress::ParallelInflateFormat::Gzip, options);
+    EXPECT(!decompressed.has_value());
+}
+
+TEST_CASE(gzip_decompress_large_truncated)
+{
+    auto original = make_text(large_input_size);
+    auto compressed = compress_as_multiple_members(original, 16);
+
+    auto decompressed_or_error = Compress::GzipDecompressor::decompress_all(compressed.bytes().trim(compressed.size() - 3));
+    EXPECT(decompressed_or_error.is_error());
+}
+
+TEST_CASE(gzip_decompress_large_corrupted_trailer)
+{
+    auto original = make_text(large_input_size);
+    auto compressed = compress_with_flushes(original, Z_FULL_FLUSH);
+
+    // Corrupt the checksum in the trailer.
+    compressed[compressed.size() - 8] ^= 1;
+
+    auto decompressed_or_error = Compress::GzipDecompressor::decompress_all(compressed);
+    EXPECT(decompressed_or_error.is_error());
+}
+
+static void benchmark_decompression(StringView name, ReadonlyBytes compressed, size_t decompressed_size)
+{
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    auto decompressed = MUST(Compress::GzipDecompressor::decompress_all(compressed));
+    auto elapsed = timer.elapsed_time();
+
+    EXPECT_EQ(decompressed.size(), decompressed_size);
+    outln("{}: {:.1} MiB/s", name, static_cast<double>(decompressed_size) / MiB / elapsed.to_nanoseconds() * 1'000'000'000);
+}
+
+BENCHMARK_CASE(gzip_decompress_throughput)
+{
+    auto original = make_text(64 * MiB);
+
+    benchmark_decompression("Single member"sv, MUST(Compress::GzipCompressor::compress_all(original)), original.size());
+    benchmark_decompression("Multiple members"sv, compress_as_multiple_members(original, 64), original.size());
+    benchmark_decompression("Full flush"sv, compress_with_flushes(original, Z_FULL_FLUSH), original.size());
+    benchmark_decompression("Sync flush"sv, compress_with_flushes(original, Z_SYNC_FLUSH), original.size());
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MaybeOwned.h>
+#include <AK/MemoryStream.h>
+#include <LibCompress/Zstd.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(zstd_decompress_simple)
+{
+    Array<u8, 28> const compressed {
+        0x28, 0xB5, 0x2F, 0xFD, 0x24, 0x0F, 0x79, 0x00, 0x00, 0x77, 0x6F, 0x72,
+        0x64, 0x31, 0x20, 0x61, 0x62, 0x63, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x32,
+        0x21, 0x35, 0xEF, 0x99
+    };
+
+    auto decompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT_EQ(StringView { decompressed }, "word1 abc word2"sv);
+}
+
+TEST_CASE(zstd_decompress_with_raw_dictionary)
+{
+    auto dictionary = "The quick brown fox jumps over the lazy dog. "sv;
+
+    Array<u8, 25> const compressed {
+        0x28, 0xB5, 0x2F, 0xFD, 0x24, 0x59, 0x65, 0x00, 0x00, 0x28, 0x54, 0x63,
+        0x61, 0x74, 0x2E, 0x01, 0x00, 0x01, 0x27, 0x25, 0x04, 0x0E, 0x66, 0x12,
+        0x29
+    };
+
+    auto decompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed, dictionary.bytes()));
+    EXPECT_EQ(StringView { decompressed }, "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy cat."sv);
+
+    // Without the dictionary, the back-references point before the start of the data.
+    EXPECT(Compress::ZstdDecompressor::decompress_all(compressed).is_error());
+}
+
+TEST_CASE(zstd_decompress_stream)
+{
+    Array<u8, 28> const compressed {
+        0x28, 0xB5, 0x2F, 0xFD, 0x24, 0x0F, 0x79, 0x00, 0x00, 0x77, 0x6F, 0x72,
+        0x64, 0x31, 0x20, 0x61, 0x62, 0x63, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x32,
+        0x21, 0x35, 0xEF, 0x99
+    };
+
+    auto stream = make<AllocatingMemoryStream>();
+    auto input = MaybeOwned<Stream> { *stream };
+    auto decompressor = TRY_OR_FAIL(Compress::ZstdDecompressor::create(move(input)));
+
+    // Feed the data in two parts to make sure the decompressor can make progress on partial input.
+    TRY_OR_FAIL(stream->write_until_depleted(compressed.span().trim(16)));
+
+    Array<u8, 32> buffer;
+    auto first_part = TRY_OR_FAIL(decompressor->read_some(buffer));
+    EXPECT(!decompressor->is_eof());
+
+    ByteBuffer decompressed;
+    decompressed.append(first_part);
+
+    TRY_OR_FAIL(stream->write_until_depleted(compressed.span().slice(16)));
+    decompressed.append(TRY_OR_FAIL(decompressor->read_some(buffer)));
+
+    // Another frame may follow, so this is only the end of the data once we say so.
+    EXPECT(!decompressor->is_eof());
+
+    decompressor->did_receive_all_input();
+    decompressed.append(TRY_OR_FAIL(decompressor->read_until_eof()));
+
+    EXPECT_EQ(StringView { decompressed }, "word1 abc word2"sv);
+}
+
+TEST_CASE(zstd_decompress_stream_split_at_frame_boundary)
+{
+    Array<u8, 22> const first_frame {
+        0x28, 0xB5, 0x2F, 0xFD, 0x00, 0x58, 0x69, 0x00, 0x00, 0x66, 0x69, 0x72,
+        0x73, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x2C, 0x20
+    };
+    Array<u8, 21> const second_frame {
+        0x28, 0xB5, 0x2F, 0xFD, 0x00, 0x58, 0x61, 0x00, 0x00, 0x73, 0x65, 0x63,
+        0x6F, 0x6E, 0x64, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65
+    };
+
+    auto stream = make<AllocatingMemoryStream>();
+    auto input = MaybeOwned<Stream> { *stream };
+    auto decompressor = TRY_OR_FAIL(Compress::ZstdDecompressor::create(move(input)));
+
+    ByteBuffer decompressed;
+    Array<u8, 64> buffer;
+
+    TRY_OR_FAIL(stream->write_until_depleted(first_frame));
+    decompressed.append(TRY_OR_FAIL(decompressor->read_some(buffer)));
+    EXPECT_EQ(StringView { decompressed }, "first frame, "sv);
+
+    // The underlying stream has run dry right after the first frame, which must not end the data.
+    decompressed.append(TRY_OR_FAIL(decompressor->read_some(buffer)));
+    EXPECT(!decompressor->is_eof());
+
+    TRY_OR_FAIL(stream->write_until_depleted(second_frame));
+    decompressor->did_receive_all_input();
+    decompressed.append(TRY_OR_FAIL(decompressor->read_until_eof()));
+
+    EXPECT_EQ(StringView { decompressed }, "first frame, second frame"sv);
+}
+
+TEST_CASE(zstd_decompress_multiple_frames)
+{
+    Array<u8, 43> const compressed {
+        0x28, 0xB5, 0x2F, 0xFD, 0x00, 0x58, 0x69, 0x00, 0x00, 0x66, 0x69, 0x72,
+        0x73, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x28, 0xB5,
+        0x2F, 0xFD, 0x00, 0x58, 0x61, 0x00, 0x00, 0x73, 0x65, 0x63, 0x6F, 0x6E,
+        0x64, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65
+    };
+
+    auto decompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT_EQ(StringView { decompressed }, "first frame, second frame"sv);
+}
+
+TEST_CASE(zstd_decompress_truncated)
+{
+    Array<u8, 28> const compressed {
+        0x28, 0xB5, 0x2F, 0xFD, 0x24, 0x0F, 0x79, 0x00, 0x00, 0x77, 0x6F, 0x72,
+        0x64, 0x31, 0x20, 0x61, 0x62, 0x63, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x32,
+        0x21, 0x35, 0xEF, 0x99
+    };
+
+    auto decompressed = Compress::ZstdDecompressor::decompress_all(compressed.span().trim(20));
+    EXPECT(decompressed.is_error());
+}
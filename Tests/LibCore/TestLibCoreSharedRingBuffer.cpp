@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <LibCore/SharedRingBuffer.h>
+#include <LibTest/TestCase.h>
+
+static constexpr size_t ring_capacity = 64;
+
+static ByteBuffer read_everything(Core::SharedRingBuffer& ring)
+{
+    ByteBuffer result;
+    for (auto bytes = ring.readable_bytes(); !bytes.is_empty(); bytes = ring.readable_bytes()) {
+        result.append(bytes);
+        ring.did_read(bytes.size());
+    }
+    return result;
+}
+
+static ByteBuffer make_data(size_t size, u8 seed = 0)
+{
+    auto data = MUST(ByteBuffer::create_uninitialized(size));
+    for (size_t i = 0; i < size; ++i)
+        data[i] = static_cast<u8>(seed + i);
+    return data;
+}
+
+TEST_CASE(write_and_read)
+{
+    auto ring = MUST(Core::SharedRingBuffer::create(ring_capacity));
+    EXPECT_EQ(ring.capacity(), ring_capacity);
+    EXPECT(ring.readable_bytes().is_empty());
+    EXPECT_EQ(ring.writable_bytes().size(), ring_capacity);
+
+    auto data = make_data(10);
+    EXPECT_EQ(ring.write_some(data), 10u);
+    EXPECT_EQ(ring.writable_bytes().size(), ring_capacity - 10);
+    EXPECT_EQ(read_everything(ring), data);
+}
+
+TEST_CASE(write_stops_when_full)
+{
+    auto ring = MUST(Core::SharedRingBuffer::create(ring_capacity));
+
+    auto data = make_data(ring_capacity + 10);
+    EXPECT_EQ(ring.write_some(data), ring_capacity);
+    EXPECT(ring.writable_bytes().is_empty());
+    EXPECT_EQ(ring.write_some(data), 0u);
+
+    EXPECT_EQ(read_everything(ring).bytes(), data.bytes().slice(0, ring_capacity));
+}
+
+TEST_CASE(write_and_read_across_the_end_of_the_ring)
+{
+    auto ring = MUST(Core::SharedRingBuffer::create(ring_capacity));
+
+    // Move both offsets close to the end, so that the next write has to wrap around.
+    EXPECT_EQ(ring.write_some(make_data(ring_capacity - 8)), ring_capacity - 8);
+    (void)read_everything(ring);
+
+    auto data = make_data(20, 100);
+    EXPECT_EQ(ring.write_some(data), 20u);
+
+    // The readable bytes are returned in two contiguous parts.
+    EXPECT_EQ(ring.readable_bytes().size(), 8u);
+    EXPECT_EQ(read_everything(ring), data);
+
+    // Keep going around the ring a few more times.
+    for (u8 i = 0; i < 10; ++i) {
+        auto chunk = make_data(ring_capacity - 1, i);
+        EXPECT_EQ(ring.write_some(chunk), chunk.size());
+        EXPECT_EQ(read_everything(ring), chunk);
+    }
+}
+
+TEST_CASE(attached_ring_shares_the_data)
+{
+    auto producer = MUST(Core::SharedRingBuffer::create(ring_capacity));
+    auto consumer = MUST(Core::SharedRingBuffer::attach(producer.anonymous_buffer()));
+    EXPECT_EQ(consumer.capacity(), ring_capacity);
+
+    auto data = make_data(ring_capacity);
+    EXPECT_EQ(producer.write_some(data), ring_capacity);
+    EXPECT_EQ(read_everything(consumer), data);
+    EXPECT_EQ(producer.writable_bytes().size(), ring_capacity);
+}
+
+TEST_CASE(attaching_rejects_invalid_buffers)
+{
+    EXPECT(Core::SharedRingBuffer::attach({}).is_error());
+
+    auto too_small = MUST(Core::AnonymousBuffer::create_with_size(8));
+    EXPECT(Core::SharedRingBuffer::attach(too_small).is_error());
+
+    auto ring = MUST(Core::SharedRingBuffer::create(ring_capacity));
+    auto not_a_power_of_two = MUST(Core::AnonymousBuffer::create_with_size(ring.anonymous_buffer().size() + 1));
+    EXPECT(Core::SharedRingBuffer::attach(not_a_power_of_two).is_error());
+}
+
+TEST_CASE(offsets_from_a_misbehaving_peer_are_clamped)
+{
+    {
+        auto ring = MUST(Core::SharedRingBuffer::create(ring_capacity));
+
+        // A producer that claims to have written more than fits in the ring can't make us read past its end.
+        ring.did_write(ring_capacity * 4 + 3);
+        auto readable = ring.readable_bytes();
+        EXPECT(readable.size() <= ring_capacity);
+        EXPECT(readable.data() >= ring.anonymous_buffer().data<u8>());
+        EXPECT(readable.data() + readable.size() <= ring.anonymous_buffer().data<u8>() + ring.anonymous_buffer().size());
+        EXPECT(ring.writable_bytes().is_empty());
+    }
+
+    {
+        auto ring = MUST(Core::SharedRingBuffer::create(ring_capacity));
+
+        // A consumer that claims to have read more than was written leaves nothing to read or write.
+        ring.did_read(10);
+        EXPECT(ring.readable_bytes().is_empty());
+        EXPECT(ring.writable_bytes().is_empty());
+        EXPECT_EQ(ring.write_some(make_data(4)), 0u);
+    }
+}
+
+TEST_CASE(eof_once_closed_and_drained)
+{
+    auto ring = MUST(Core::SharedRingBuffer::create(ring_capacity));
+    EXPECT(!ring.is_eof());
+
+    auto data = make_data(16);
+    EXPECT_EQ(ring.write_some(data), 16u);
+    ring.close_for_writing();
+
+    EXPECT(ring.is_closed_for_writing());
+    EXPECT(!ring.is_eof());
+
+    EXPECT_EQ(read_everything(ring), data);
+    EXPECT(ring.is_eof());
+}
+
+TEST_CASE(waiting_flags_are_taken_once)
+{
+    auto ring = MUST(Core::SharedRingBuffer::create(ring_capacity));
+
+    EXPECT(!ring.take_reader_waiting());
+    ring.set_reader_waiting(true);
+    EXPECT(ring.take_reader_waiting());
+    EXPECT(!ring.take_reader_waiting());
+
+    ring.set_writer_waiting(true);
+    ring.set_writer_waiting(false);
+    EXPECT(!ring.take_writer_waiting());
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <LibCore/Tracing.h>
+#include <LibTest/TestCase.h>
+
+static JsonArray stop_and_read_trace_events()
+{
+    auto path = ByteString::formatted("{}/test-tracing-{}.json", Core::StandardPaths::tempfile_directory(), Core::System::getpid());
+    MUST(Core::Tracing::stop_and_write_to_file(path));
+
+    auto file = MUST(Core::File::open(path, Core::File::OpenMode::Read));
+    auto contents = MUST(file->read_until_eof());
+    MUST(Core::System::unlink(path));
+
+    auto json = MUST(JsonValue::from_string(contents));
+    auto events = json.as_object().get_array("traceEvents"sv);
+    VERIFY(events.has_value());
+    return *events;
+}
+
+TEST_CASE(events_are_not_recorded_while_disabled)
+{
+    EXPECT(!Core::Tracing::is_enabled());
+
+    {
+        Core::ScopedTraceEvent event { "test"sv, "disabled"sv };
+    }
+
+    Core::Tracing::start();
+    EXPECT(Core::Tracing::is_enabled());
+
+    auto events = stop_and_read_trace_events();
+    EXPECT(!Core::Tracing::is_enabled());
+    EXPECT(events.is_empty());
+}
+
+TEST_CASE(scoped_events_are_recorded)
+{
+    Core::Tracing::start();
+
+    {
+        Core::ScopedTraceEvent outer { "test"sv, "outer"sv };
+        Core::ScopedTraceEvent inner { "test"sv, "inner"sv };
+    }
+
+    auto events = stop_and_read_trace_events();
+    EXPECT_EQ(events.size(), 2u);
+
+    // Events are recorded when they end, so the inner event comes first.
+    auto const& inner = events.at(0).as_object();
+    EXPECT_EQ(inner.get_string("cat"sv), "test"_string);
+    EXPECT_EQ(inner.get_string("name"sv), "inner"_string);
+    EXPECT_EQ(inner.get_string("ph"sv), "X"_string);
+
+    auto const& outer = events.at(1).as_object();
+    EXPECT_EQ(outer.get_string("name"sv), "outer"_string);
+    EXPECT(outer.get_integer<i64>("ts"sv).value() <= inner.get_integer<i64>("ts"sv).value());
+    EXPECT_EQ(outer.get_integer<i64>("tid"sv), inner.get_integer<i64>("tid"sv));
+}
+
+TEST_CASE(starting_discards_previous_events)
+{
+    Core::Tracing::start();
+    {
+        Core::ScopedTraceEvent event { "test"sv, "discarded"sv };
+    }
+
+    Core::Tracing::start();
+    {
+        Core::ScopedTraceEvent event { "test"sv, "kept"sv };
+    }
+
+    auto events = stop_and_read_trace_events();
+    EXPECT_EQ(events.size(), 1u);
+    EXPECT_EQ(events.at(0).as_object().get_string("name"sv), "kept"_string);
+}
@@ -4,7 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/MemoryStream.h>
 #include <LibCore/Socket.h>
+#include <LibCore/Timer.h>
+#include <LibCore/UDPServer.h>
 #include <LibDNS/Resolver.h>
 #include <LibTLS/TLSv12.h>
 #include <LibTest/TestCase.h>
@@ -102,3 +105,207 @@ TEST_CASE(test_tls)
 
     EXPECT_EQ(0, loop.exec());
 }
+
+// A DNS server on the loopback interface, so that the resolver can be tested without network access.
+class FakeDNSServer {
+public:
+    struct Response {
+        Vector<DNS::Messages::ResourceRecord> answers;
+        Vector<DNS::Messages::ResourceRecord> authorities;
+        DNS::Messages::Options::ResponseCode response_code { DNS::Messages::Options::ResponseCode::NoError };
+        int delay_ms { 0 };
+    };
+    using Handler = Function<Response(DNS::Messages::Question const&)>;
+
+    explicit FakeDNSServer(Handler handler)
+        : m_server(Core::UDPServer::construct())
+        , m_handler(move(handler))
+    {
+        VERIFY(m_server->bind({ 127, 0, 0, 1 }, 0));
+        m_server->on_ready_to_receive = [this] { respond_to_query(); };
+    }
+
+    Function<ErrorOr<DNS::Resolver::SocketResult>()> create_socket() const
+    {
+        return [port = m_server->local_port().value()] -> ErrorOr<DNS::Resolver::SocketResult> {
+            Core::SocketAddress address { IPv4Address { 127, 0, 0, 1 }, port };
+            return DNS::Resolver::SocketResult {
+                TRY(Core::BufferedSocket<Core::UDPSocket>::create(TRY(Core::UDPSocket::connect(address)))),
+                DNS::Resolver::ConnectionMode::UDP,
+            };
+        };
+    }
+
+    size_t query_count() const { return m_query_count; }
+
+private:
+    void respond_to_query()
+    {
+        sockaddr_in from {};
+        auto bytes = MUST(m_server->receive(4096, from));
+
+        FixedMemoryStream stream { bytes.bytes() };
+        auto query = MUST(DNS::Messages::Message::from_raw(stream));
+        VERIFY(query.questions.size() == 1);
+        ++m_query_count;
+
+        auto response = m_handler(query.questions.first());
+
+        DNS::Messages::Message message;
+        message.header.id = query.header.id;
+        message.header.options.set_response_code(response.response_code);
+        message.header.question_count = 1;
+        message.header.answer_count = response.answers.size();
+        message.header.authority_count = response.authorities.size();
+        message.questions = move(query.questions);
+        message.answers = move(response.answers);
+        message.authorities = move(response.authorities);
+
+        ByteBuffer message_bytes;
+        MUST(message.to_raw(message_bytes));
+
+        if (response.delay_ms == 0) {
+            MUST(m_server->send(message_bytes, from));
+            return;
+        }
+
+        auto timer = Core::Timer::create_single_shot(response.delay_ms, [this, message_bytes = move(message_bytes), from] {
+            MUST(m_server->send(message_bytes, from));
+        });
+        timer->start();
+        m_delayed_responses.append(move(timer));
+    }
+
+    NonnullRefPtr<Core::UDPServer> m_server;
+    Handler m_handler;
+    size_t m_query_count { 0 };
+    Vector<NonnullRefPtr<Core::Timer>> m_delayed_responses;
+};
+
+static DNS::Messages::ResourceRecord make_record(DNS::Messages::Question const& question, DNS::Messages::ResourceType type, DNS::Messages::Record record, u32 ttl = 300)
+{
+    return { .name = question.name, .type = type, .class_ = DNS::Messages::Class::IN, .ttl = ttl, .record = move(record), .raw = {} };
+}
+
+static DNS::Messages::ResourceRecord make_soa_record(DNS::Messages::Question const& question, u32 ttl)
+{
+    DNS::Messages::Records::SOA soa {
+        .mname = DNS::Messages::DomainName::from_string("ns.test"sv),
+        .rname = DNS::Messages::DomainName::from_string("admin.test"sv),
+        .serial = 1,
+        .refresh = 3600,
+        .retry = 600,
+        .expire = 86400,
+        .minimum = ttl,
+    };
+    return make_record(question, DNS::Messages::ResourceType::SOA, move(soa), ttl);
+}
+
+static void pump_event_loop_until(Function<bool()> condition)
+{
+    auto deadline = MonotonicTime::now() + AK::Duration::from_seconds(5);
+    while (!condition()) {
+        VERIFY(MonotonicTime::now() < deadline);
+        Core::EventLoop::current().pump(Core::EventLoop::WaitMode::PollForEvents);
+    }
+}
+
+TEST_CASE(negative_answers_are_cached)
+{
+    Core::EventLoop loop;
+
+    FakeDNSServer server { [](auto const& question) {
+        FakeDNSServer::Response response;
+        response.response_code = DNS::Messages::Options::ResponseCode::NameError;
+        if (question.name.to_string() == "missing.test."sv)
+            response.authorities.append(make_soa_record(question, 60));
+        return response;
+    } };
+
+    DNS::Resolver resolver { server.create_socket() };
+    TRY_OR_FAIL(resolver.when_socket_ready()->await());
+
+    auto result = TRY_OR_FAIL(resolver.lookup_addresses("missing.test")->await());
+    EXPECT(result->records().is_empty());
+    EXPECT_EQ(server.query_count(), 2u);
+
+    result = TRY_OR_FAIL(resolver.lookup_addresses("missing.test")->await());
+    EXPECT(result->records().is_empty());
+    EXPECT_EQ(server.query_count(), 2u);
+    EXPECT(resolver.lookup_in_cache("missing.test"sv));
+
+    // Without an SOA record, negative answers must not be cached.
+    (void)TRY_OR_FAIL(resolver.lookup_addresses("uncacheable.test")->await());
+    (void)TRY_OR_FAIL(resolver.lookup_addresses("uncacheable.test")->await());
+    EXPECT_EQ(server.query_count(), 6u);
+}
+
+TEST_CASE(lookup_addresses_waits_for_both_address_families)
+{
+    Core::EventLoop loop;
+
+    FakeDNSServer server { [](auto const& question) {
+        FakeDNSServer::Response response;
+        if (question.type == DNS::Messages::ResourceType::AAAA) {
+            response.answers.append(make_record(question, DNS::Messages::ResourceType::AAAA, DNS::Messages::Records::AAAA { IPv6Address::loopback() }));
+        } else {
+            // Answer well after the AAAA records have arrived.
+            response.answers.append(make_record(question, DNS::Messages::ResourceType::A, DNS::Messages::Records::A { IPv4Address { 192, 0, 2, 1 } }));
+            response.delay_ms = 200;
+        }
+        return response;
+    } };
+
+    DNS::Resolver resolver { server.create_socket() };
+    TRY_OR_FAIL(resolver.when_socket_ready()->await());
+
+    auto result = TRY_OR_FAIL(resolver.lookup_addresses("dual-stack.test")->await());
+    EXPECT(result->has_record_of_type(DNS::Messages::ResourceType::A));
+    EXPECT(result->has_record_of_type(DNS::Messages::ResourceType::AAAA));
+    EXPECT_EQ(result->cached_addresses().size(), 2u);
+    EXPECT_EQ(server.query_count(), 2u);
+}
+
+TEST_CASE(stale_results_are_served_while_they_are_refreshed)
+{
+    Core::EventLoop loop;
+
+    static constexpr IPv4Address stale_address { 192, 0, 2, 1 };
+    static constexpr IPv4Address fresh_address { 192, 0, 2, 2 };
+
+    size_t answer_count = 0;
+    FakeDNSServer server { [&](auto const& question) {
+        FakeDNSServer::Response response;
+        if (answer_count++ == 0) {
+            // This expires within the refresh window right away.
+            response.answers.append(make_record(question, DNS::Messages::ResourceType::A, DNS::Messages::Records::A { stale_address }, 1));
+        } else {
+            response.answers.append(make_record(question, DNS::Messages::ResourceType::A, DNS::Messages::Records::A { fresh_address }));
+        }
+        return response;
+    } };
+
+    DNS::Resolver resolver { server.create_socket() };
+    TRY_OR_FAIL(resolver.when_socket_ready()->await());
+
+    auto lookup_address = [&]() -> IPv4Address {
+        auto result = MUST(resolver.lookup("refresh.test", DNS::Messages::Class::IN, Vector { DNS::Messages::ResourceType::A })->await());
+        return result->record<DNS::Messages::Records::A>().address;
+    };
+
+    EXPECT_EQ(lookup_address(), stale_address);
+    EXPECT_EQ(server.query_count(), 1u);
+
+    // The stale result is served from the cache, and looked up again in the background.
+    EXPECT_EQ(lookup_address(), stale_address);
+    pump_event_loop_until([&] { return server.query_count() == 2; });
+
+    // Until the refresh is done, the stale result is still served.
+    pump_event_loop_until([&] {
+        auto result = resolver.lookup_in_cache("refresh.test"sv, DNS::Messages::Class::IN, Array { DNS::Messages::ResourceType::A });
+        return result && result->record<DNS::Messages::Records::A>().address == fresh_address;
+    });
+
+    EXPECT_EQ(lookup_address(), fresh_address);
+    EXPECT_EQ(server.query_count(), 2u);
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibIPC/AutoCloseFileDescriptor.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibIPC/LargeBytes.h>
+#include <LibTest/TestCase.h>
+
+static ByteBuffer make_payload(size_t size)
+{
+    auto payload = MUST(ByteBuffer::create_uninitialized(size));
+    for (size_t i = 0; i < size; ++i)
+        payload[i] = static_cast<u8>(i * 7);
+    return payload;
+}
+
+static IPC::LargeBytes round_trip(ReadonlyBytes payload)
+{
+    IPC::MessageBuffer buffer;
+    IPC::Encoder encoder { buffer };
+    MUST(encoder.encode_large_bytes(payload));
+
+    auto data = buffer.take_data();
+    Queue<IPC::File> files;
+    for (auto& fd : buffer.take_fds())
+        files.enqueue(IPC::File::adopt_fd(fd->take_fd()));
+
+    FixedMemoryStream stream { data.span() };
+    IPC::Decoder decoder { stream, files };
+    auto result = MUST(decoder.decode<IPC::LargeBytes>());
+
+    EXPECT(stream.is_eof());
+    EXPECT(files.is_empty());
+    return result;
+}
+
+TEST_CASE(small_payload_is_encoded_inline)
+{
+    auto payload = make_payload(IPC::LargeBytes::shared_memory_threshold - 1);
+
+    auto result = round_trip(payload);
+    EXPECT(!result.is_in_shared_memory());
+    EXPECT_EQ(result.bytes(), payload.bytes());
+
+    auto released = MUST(result.release_byte_buffer());
+    EXPECT_EQ(released, payload);
+}
+
+TEST_CASE(empty_payload)
+{
+    auto result = round_trip({});
+    EXPECT(!result.is_in_shared_memory());
+    EXPECT(result.is_empty());
+}
+
+TEST_CASE(large_payload_is_passed_through_shared_memory)
+{
+    auto payload = make_payload(IPC::LargeBytes::shared_memory_threshold);
+
+    auto result = round_trip(payload);
+    EXPECT(result.is_in_shared_memory());
+    EXPECT_EQ(result.size(), payload.size());
+    EXPECT_EQ(result.bytes(), payload.bytes());
+
+    auto released = MUST(result.release_byte_buffer());
+    EXPECT_EQ(released, payload);
+}
+
+TEST_CASE(shared_memory_buffers_are_reused_once_released)
+{
+    auto& pool = IPC::SharedMemoryPool::the();
+    auto payload = make_payload(100 * KiB);
+
+    auto first = round_trip(payload);
+    auto pooled_buffer_count = pool.pooled_buffer_count();
+
+    // The first buffer is still in use by the receiver, so the pool has to hand out another one.
+    {
+        auto second = round_trip(payload);
+        EXPECT_EQ(second.bytes(), payload.bytes());
+        EXPECT_EQ(pool.pooled_buffer_count(), pooled_buffer_count + 1);
+    }
+
+    // Now that the second buffer was released, it may be reused.
+    auto third = round_trip(payload);
+    EXPECT_EQ(third.bytes(), payload.bytes());
+    EXPECT_EQ(pool.pooled_buffer_count(), pooled_buffer_count + 1);
+
+    // Releasing a buffer must not corrupt the payload that is still held in another one.
+    EXPECT_EQ(first.bytes(), payload.bytes());
+}
+
+TEST_CASE(released_buffers_are_reused)
+{
+    auto& pool = IPC::SharedMemoryPool::the();
+
+    // A buffer that never reaches a receiver has to be handed back explicitly, as nobody else would clear its flag.
+    auto buffer = MUST(pool.acquire(100 * KiB));
+    auto pooled_buffer_count = pool.pooled_buffer_count();
+    pool.release(buffer);
+
+    auto reused_buffer = MUST(pool.acquire(100 * KiB));
+    EXPECT_EQ(pool.pooled_buffer_count(), pooled_buffer_count);
+    pool.release(reused_buffer);
+}
+
+TEST_CASE(oversized_payloads_are_not_pooled)
+{
+    auto& pool = IPC::SharedMemoryPool::the();
+    auto pooled_buffer_count = pool.pooled_buffer_count();
+
+    auto payload = make_payload(8 * MiB);
+    auto result = round_trip(payload);
+    EXPECT(result.is_in_shared_memory());
+    EXPECT_EQ(result.bytes(), payload.bytes());
+    EXPECT_EQ(pool.pooled_buffer_count(), pooled_buffer_count);
+}
+
+TEST_CASE(truncated_shared_memory_buffer_is_rejected)
+{
+    auto buffer = MUST(Core::AnonymousBuffer::create_with_size(IPC::LargeBytes::shared_memory_header_size + 16));
+
+    EXPECT(!IPC::LargeBytes::create_from_shared_memory(buffer, 16).is_error());
+    EXPECT(IPC::LargeBytes::create_from_shared_memory(buffer, 4096).is_error());
+    EXPECT(IPC::LargeBytes::create_from_shared_memory({}, 0).is_error());
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibIPC/Statistics.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(statistics_are_grouped_by_endpoint)
+{
+    auto& statistics = IPC::Statistics::the();
+
+    statistics.record_sent_message("TestEndpoint::Ping"sv, 16);
+    statistics.record_sent_message("TestEndpoint::Ping"sv, 32);
+    statistics.record_received_message("TestEndpoint::Pong"sv, 8);
+    statistics.record_handled_message("TestEndpoint::Pong"sv, AK::Duration::from_microseconds(3), AK::Duration::from_microseconds(100));
+    statistics.record_synchronous_round_trip("OtherEndpoint::Request"sv, AK::Duration::from_milliseconds(2));
+
+    auto json = MUST(JsonValue::from_string(statistics.serialize_as_json()));
+    auto endpoints = json.as_object().get_object("endpoints"sv);
+    VERIFY(endpoints.has_value());
+
+    auto test_endpoint = endpoints->get_object("TestEndpoint"sv);
+    VERIFY(test_endpoint.has_value());
+
+    auto ping = test_endpoint->get_object("Ping"sv);
+    VERIFY(ping.has_value());
+    EXPECT_EQ(ping->get_u64("sent_count"sv), 2u);
+    EXPECT_EQ(ping->get_u64("sent_bytes"sv), 48u);
+    EXPECT_EQ(ping->get_u64("received_count"sv), 0u);
+    EXPECT(!ping->has_object("handling_time"sv));
+
+    auto pong = test_endpoint->get_object("Pong"sv);
+    VERIFY(pong.has_value());
+    EXPECT_EQ(pong->get_u64("received_count"sv), 1u);
+    EXPECT_EQ(pong->get_u64("received_bytes"sv), 8u);
+
+    auto handling_time = pong->get_object("handling_time"sv);
+    VERIFY(handling_time.has_value());
+    EXPECT_EQ(handling_time->get_u64("count"sv), 1u);
+    EXPECT_EQ(handling_time->get_u64("max_us"sv), 100u);
+
+    // 100us falls into the bucket for [64us, 128us).
+    auto buckets = handling_time->get_array("buckets"sv);
+    VERIFY(buckets.has_value());
+    EXPECT_EQ(buckets->size(), 1u);
+    EXPECT_EQ(buckets->at(0).as_object().get_u64("upper_bound_us"sv), 128u);
+
+    auto other_endpoint = endpoints->get_object("OtherEndpoint"sv);
+    VERIFY(other_endpoint.has_value());
+    auto request = other_endpoint->get_object("Request"sv);
+    VERIFY(request.has_value());
+    EXPECT(request->has_object("round_trip_time"sv));
+}
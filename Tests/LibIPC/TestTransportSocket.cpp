@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <LibCore/System.h>
+#include <LibIPC/TransportSocket.h>
+#include <LibTest/TestCase.h>
+
+static constexpr IPC::CoalescingKey first_key { .endpoint_magic = 1, .message_id = 1, .discriminator = 1 };
+static constexpr IPC::CoalescingKey second_key { .endpoint_magic = 1, .message_id = 1, .discriminator = 2 };
+
+static Vector<u8> make_message(u8 value)
+{
+    return { value };
+}
+
+static Vector<u8> drain(IPC::SendQueue& queue)
+{
+    auto [bytes, fds] = queue.peek(NumericLimits<size_t>::max());
+    queue.discard(bytes.size(), fds.size());
+    return bytes;
+}
+
+TEST_CASE(coalescable_messages_replace_each_other)
+{
+    auto queue = adopt_ref(*new IPC::SendQueue);
+
+    queue->enqueue_message(make_message(1), {}, first_key);
+    queue->enqueue_message(make_message(2), {}, first_key);
+    queue->enqueue_message(make_message(3), {}, first_key);
+
+    EXPECT_EQ(drain(*queue), (Vector<u8> { 3 }));
+}
+
+TEST_CASE(coalescable_messages_with_different_keys_are_kept)
+{
+    auto queue = adopt_ref(*new IPC::SendQueue);
+
+    queue->enqueue_message(make_message(1), {}, first_key);
+    queue->enqueue_message(make_message(2), {}, second_key);
+    queue->enqueue_message(make_message(3), {}, first_key);
+
+    EXPECT_EQ(drain(*queue), (Vector<u8> { 1, 2, 3 }));
+}
+
+TEST_CASE(non_coalescable_messages_keep_their_order)
+{
+    auto queue = adopt_ref(*new IPC::SendQueue);
+
+    queue->enqueue_message(make_message(1), {}, first_key);
+    queue->enqueue_message(make_message(2), {});
+    queue->enqueue_message(make_message(3), {}, first_key);
+    queue->enqueue_message(make_message(4), {});
+    queue->enqueue_message(make_message(5), {});
+
+    // A coalescable message may only be replaced while it is the most recently queued message, so 1 must survive.
+    EXPECT_EQ(drain(*queue), (Vector<u8> { 1, 2, 3, 4, 5 }));
+}
+
+TEST_CASE(messages_that_were_handed_to_the_send_thread_are_not_replaced)
+{
+    auto queue = adopt_ref(*new IPC::SendQueue);
+
+    queue->enqueue_message(make_message(1), {}, first_key);
+    auto [bytes, fds] = queue->peek(NumericLimits<size_t>::max());
+    EXPECT_EQ(bytes, (Vector<u8> { 1 }));
+
+    queue->enqueue_message(make_message(2), {}, first_key);
+    queue->discard(bytes.size(), fds.size());
+
+    EXPECT_EQ(drain(*queue), (Vector<u8> { 2 }));
+}
+
+static Array<NonnullOwnPtr<Core::LocalSocket>, 2> create_paired_sockets()
+{
+    int fds[2] = {};
+    MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+
+    auto socket0 = MUST(Core::LocalSocket::adopt_fd(fds[0]));
+    MUST(socket0->set_blocking(false));
+    auto socket1 = MUST(Core::LocalSocket::adopt_fd(fds[1]));
+    MUST(socket1->set_blocking(false));
+
+    return Array { move(socket0), move(socket1) };
+}
+
+TEST_CASE(transport_delivers_messages_in_order)
+{
+    auto sockets = create_paired_sockets();
+    IPC::TransportSocket sender { move(sockets[0]) };
+    IPC::TransportSocket receiver { move(sockets[1]) };
+
+    // Whether the coalescable messages are replaced depends on how quickly the send thread picks them up, but the
+    // latest one of them must always arrive, and nothing may be reordered.
+    sender.post_message(make_message(1), {}, first_key);
+    sender.post_message(make_message(2), {});
+    sender.post_message(make_message(3), {}, first_key);
+    sender.post_message(make_message(4), {}, first_key);
+    sender.post_message(make_message(5), {}, first_key);
+    sender.post_message(make_message(6), {});
+    sender.post_message(make_message(7), {}, second_key);
+    sender.close_after_sending_all_pending_messages();
+
+    Vector<u8> received;
+    for (;;) {
+        receiver.wait_until_readable();
+
+        auto should_shutdown = receiver.read_as_many_messages_as_possible_without_blocking([&](auto&& message) {
+            EXPECT_EQ(message.bytes.size(), 1u);
+            received.append(message.bytes.first());
+        });
+
+        if (should_shutdown == IPC::TransportSocket::ShouldShutdown::Yes)
+            break;
+    }
+
+    EXPECT(received.size() >= 5u);
+    EXPECT_EQ(received.first(), 1);
+    EXPECT_EQ(received.last(), 7);
+
+    for (size_t i = 1; i < received.size(); ++i)
+        EXPECT(received[i - 1] < received[i]);
+
+    EXPECT(received.contains_slow(2));
+    EXPECT(received.contains_slow(5));
+    EXPECT(received.contains_slow(6));
+}
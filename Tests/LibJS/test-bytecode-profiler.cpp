@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Profiler.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static void run_script(JS::Realm& realm, StringView source)
+{
+    auto script = JS::Script::parse(source, realm, "test.js"sv);
+    VERIFY(!script.is_error());
+
+    auto result = realm.vm().bytecode_interpreter().run(*script.value());
+    EXPECT(!result.is_error());
+}
+
+static JS::ThrowCompletionOr<JS::Value> start_profiling(JS::VM& vm)
+{
+    vm.bytecode_interpreter().set_profiling_enabled(true);
+    return JS::js_undefined();
+}
+
+static JS::ThrowCompletionOr<JS::Value> stop_profiling(JS::VM& vm)
+{
+    vm.bytecode_interpreter().set_profiling_enabled(false);
+    return JS::js_undefined();
+}
+
+static void define_profiling_functions(JS::Realm& realm)
+{
+    u8 attributes = JS::Attribute::Configurable | JS::Attribute::Writable;
+    realm.global_object().define_native_function(realm, "startProfiling"_fly_string, start_profiling, 0, attributes);
+    realm.global_object().define_native_function(realm, "stopProfiling"_fly_string, stop_profiling, 0, attributes);
+}
+
+TEST_CASE(instructions_and_executables_are_recorded)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto& interpreter = vm->bytecode_interpreter();
+    interpreter.set_profiling_enabled(true);
+
+    run_script(realm, R"(
+        function profiledFunction(object) { return object.value + 1; }
+        let sum = 0;
+        for (let i = 0; i < 100; ++i)
+            sum += profiledFunction({ value: i });
+    )"sv);
+
+    auto* profiler = interpreter.profiler();
+    VERIFY(profiler);
+    EXPECT(profiler->instruction_count(JS::Bytecode::Instruction::Type::Call) >= 100u);
+
+    auto report = profiler->report();
+    EXPECT(report.contains("profiledFunction (test.js:"sv));
+    EXPECT(report.contains("Property lookup caches:"sv));
+
+    interpreter.set_profiling_enabled(false);
+    EXPECT(!interpreter.profiler());
+}
+
+TEST_CASE(profiling_can_be_stopped_while_running)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+    define_profiling_functions(realm);
+
+    auto& interpreter = vm->bytecode_interpreter();
+    interpreter.set_profiling_enabled(true);
+
+    // The script keeps running with the profiling dispatch table after the profiler is gone.
+    run_script(realm, R"(
+        let sum = 0;
+        stopProfiling();
+        for (let i = 0; i < 100; ++i)
+            sum += i;
+    )"sv);
+
+    EXPECT(!interpreter.profiler());
+}
+
+TEST_CASE(profiling_can_be_started_while_running)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+    define_profiling_functions(realm);
+
+    auto& interpreter = vm->bytecode_interpreter();
+
+    // The outer executables finish without ever having been seen by the profiler.
+    run_script(realm, R"(
+        function inner() { return 1; }
+        startProfiling();
+        let sum = 0;
+        for (let i = 0; i < 10; ++i)
+            sum += inner();
+    )"sv);
+
+    auto* profiler = interpreter.profiler();
+    VERIFY(profiler);
+    EXPECT(profiler->report().contains("inner (test.js:"sv));
+
+    // Restarting in the middle of a run must not mix up the frames of the old and new profile.
+    run_script(realm, R"(
+        function restart() { stopProfiling(); startProfiling(); return 1; }
+        for (let i = 0; i < 10; ++i)
+            restart();
+    )"sv);
+
+    EXPECT(interpreter.profiler());
+}
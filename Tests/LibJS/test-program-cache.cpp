@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibJS/Lexer.h>
+#include <LibJS/Parser.h>
+#include <LibJS/ProgramCache.h>
+#include <LibJS/SourceCode.h>
+#include <LibTest/TestCase.h>
+
+static ByteString make_source(size_t seed, size_t minimum_length = JS::ProgramCache::minimum_source_length)
+{
+    StringBuilder builder;
+    for (size_t i = 0; builder.length() < minimum_length; ++i)
+        builder.appendff("var value_{}_{} = {};\n", seed, i, i);
+    return builder.to_byte_string();
+}
+
+static NonnullRefPtr<JS::Program> parse(StringView source, StringView filename = "test.js"sv, JS::Program::Type type = JS::Program::Type::Script, size_t line_number_offset = 1)
+{
+    auto parser = JS::Parser(JS::Lexer(source, filename, line_number_offset), type);
+    auto program = parser.parse_program();
+    VERIFY(!parser.has_errors());
+    return program;
+}
+
+TEST_CASE(hit_returns_the_cached_program)
+{
+    JS::ProgramCache cache;
+    auto source = make_source(0);
+    auto program = parse(source);
+    cache.insert(program);
+
+    auto cached = cache.find(JS::Program::Type::Script, source, "test.js"sv);
+    EXPECT_EQ(cached.ptr(), program.ptr());
+}
+
+TEST_CASE(miss_on_any_difference)
+{
+    JS::ProgramCache cache;
+    auto source = make_source(0);
+    cache.insert(parse(source), 10);
+
+    EXPECT(cache.find(JS::Program::Type::Script, source, "test.js"sv, 10));
+
+    EXPECT(!cache.find(JS::Program::Type::Module, source, "test.js"sv, 10));
+    EXPECT(!cache.find(JS::Program::Type::Script, source, "other.js"sv, 10));
+    EXPECT(!cache.find(JS::Program::Type::Script, source, "test.js"sv, 1));
+
+    // Same length, different contents.
+    auto other_source = source.replace("value_0_"sv, "value_x_"sv, ReplaceMode::FirstOnly);
+    EXPECT_EQ(other_source.length(), source.length());
+    EXPECT(!cache.find(JS::Program::Type::Script, other_source, "test.js"sv, 10));
+}
+
+TEST_CASE(small_sources_are_not_cached)
+{
+    JS::ProgramCache cache;
+    auto source = "var small = 1;"sv;
+    cache.insert(parse(source));
+
+    EXPECT(!cache.find(JS::Program::Type::Script, source, "test.js"sv));
+}
+
+TEST_CASE(least_recently_used_entries_are_evicted_first)
+{
+    JS::ProgramCache cache;
+
+    Vector<ByteString> sources;
+    for (size_t i = 0; i < JS::ProgramCache::maximum_number_of_entries; ++i) {
+        sources.append(make_source(i));
+        cache.insert(parse(sources.last()));
+    }
+
+    // Touch the oldest entry, so that the second oldest one is evicted instead.
+    EXPECT(cache.find(JS::Program::Type::Script, sources[0], "test.js"sv));
+
+    auto newest_source = make_source(JS::ProgramCache::maximum_number_of_entries);
+    cache.insert(parse(newest_source));
+
+    EXPECT(cache.find(JS::Program::Type::Script, sources[0], "test.js"sv));
+    EXPECT(!cache.find(JS::Program::Type::Script, sources[1], "test.js"sv));
+    EXPECT(cache.find(JS::Program::Type::Script, sources[2], "test.js"sv));
+    EXPECT(cache.find(JS::Program::Type::Script, newest_source, "test.js"sv));
+}
+
+TEST_CASE(clear_invalidates_all_entries)
+{
+    JS::ProgramCache cache;
+    auto first_source = make_source(0);
+    auto second_source = make_source(1);
+    cache.insert(parse(first_source));
+    cache.insert(parse(second_source));
+
+    cache.clear();
+
+    EXPECT(!cache.find(JS::Program::Type::Script, first_source, "test.js"sv));
+    EXPECT(!cache.find(JS::Program::Type::Script, second_source, "test.js"sv));
+}
+
+TEST_CASE(idle_entries_are_evicted)
+{
+    JS::ProgramCache cache;
+    auto first_source = make_source(0);
+    auto second_source = make_source(1);
+    cache.insert(parse(first_source));
+    cache.insert(parse(second_source));
+
+    cache.evict_idle_entries();
+    EXPECT(!cache.is_empty());
+
+    cache.evict_idle_entries(JS::ProgramCache::maximum_idle_time);
+    EXPECT(cache.is_empty());
+    EXPECT(!cache.find(JS::Program::Type::Script, first_source, "test.js"sv));
+    EXPECT(!cache.find(JS::Program::Type::Script, second_source, "test.js"sv));
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <LibRequests/RequestPriority.h>
+#include <LibTest/TestCase.h>
+
+using Requests::ALPNHttpVersion;
+using Requests::RequestPriority;
+
+static constexpr Array all_priorities {
+    RequestPriority::Lowest,
+    RequestPriority::Low,
+    RequestPriority::Medium,
+    RequestPriority::High,
+    RequestPriority::Highest,
+};
+
+TEST_CASE(invalid_priorities_are_rejected)
+{
+    for (auto priority : all_priorities)
+        EXPECT(Requests::is_valid_request_priority(priority));
+
+    EXPECT(!Requests::is_valid_request_priority(static_cast<RequestPriority>(to_underlying(RequestPriority::Highest) + 1)));
+    EXPECT(!Requests::is_valid_request_priority(static_cast<RequestPriority>(0xff)));
+}
+
+TEST_CASE(raising_and_lowering_priorities)
+{
+    EXPECT_EQ(Requests::raise_request_priority(RequestPriority::Medium), RequestPriority::High);
+    EXPECT_EQ(Requests::raise_request_priority(RequestPriority::Highest), RequestPriority::Highest);
+
+    EXPECT_EQ(Requests::lower_request_priority(RequestPriority::Medium), RequestPriority::Low);
+    EXPECT_EQ(Requests::lower_request_priority(RequestPriority::Lowest), RequestPriority::Lowest);
+}
+
+TEST_CASE(higher_priorities_are_more_urgent)
+{
+    for (size_t i = 1; i < all_priorities.size(); ++i) {
+        auto lower = all_priorities[i - 1];
+        auto higher = all_priorities[i];
+
+        EXPECT(Requests::request_priority_to_http2_stream_weight(higher) > Requests::request_priority_to_http2_stream_weight(lower));
+        EXPECT(Requests::request_priority_to_urgency(higher) < Requests::request_priority_to_urgency(lower));
+    }
+
+    for (auto priority : all_priorities) {
+        auto weight = Requests::request_priority_to_http2_stream_weight(priority);
+        EXPECT(weight >= 1 && weight <= 256);
+        EXPECT(Requests::request_priority_to_urgency(priority) <= 7);
+    }
+
+    EXPECT_EQ(Requests::request_priority_to_urgency(RequestPriority::Medium), 3);
+}
+
+TEST_CASE(priority_header_is_only_sent_over_multiplexed_connections)
+{
+    EXPECT(Requests::should_send_priority_header(RequestPriority::High, ALPNHttpVersion::Http2_TLS));
+    EXPECT(Requests::should_send_priority_header(RequestPriority::Low, ALPNHttpVersion::Http3));
+
+    EXPECT(!Requests::should_send_priority_header(RequestPriority::High, ALPNHttpVersion::None));
+    EXPECT(!Requests::should_send_priority_header(RequestPriority::High, ALPNHttpVersion::Http1_0));
+    EXPECT(!Requests::should_send_priority_header(RequestPriority::Highest, ALPNHttpVersion::Http1_1));
+
+    // The default urgency doesn't have to be sent at all.
+    EXPECT(!Requests::should_send_priority_header(RequestPriority::Medium, ALPNHttpVersion::Http2_TLS));
+    EXPECT(!Requests::should_send_priority_header(RequestPriority::Medium, ALPNHttpVersion::Http3));
+}
@@ -26,6 +26,7 @@ class Echo:
     status: int
     headers: Optional[Dict[str, str]]
     body: Optional[str]
+    body_repeat: Optional[int]
     delay_ms: Optional[int]
     reason_phrase: Optional[str]
 
@@ -57,6 +58,7 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
             echo.path = data.get("path", None)
             echo.status = data.get("status", None)
             echo.body = data.get("body", None)
+            echo.body_repeat = data.get("body_repeat", None)
             echo.delay_ms = data.get("delay_ms", None)
             echo.headers = data.get("headers", None)
             echo.reason_phrase = data.get("reason_phrase", None)
@@ -138,8 +140,16 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
                     self.send_header(header, value)
                 self.end_headers()
 
-            response_body = echo.body or ""
-            self.wfile.write(response_body.encode("utf-8"))
+            response_body = (echo.body or "").encode("utf-8")
+
+            # Large bodies are sent as the given body repeated, one copy at a time, so that the client can apply
+            # backpressure to the server while reading them.
+            try:
+                for _ in range(echo.body_repeat or 1):
+                    self.wfile.write(response_body)
+            except (BrokenPipeError, ConnectionResetError):
+                # The client went away before reading the entire body.
+                pass
         else:
             self.send_error(404, f"Echo response not found for {key}")
 
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibURL/Parser.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Cookie/ParsedCookie.h>
+#include <LibWebView/CookieJar.h>
+
+static URL::URL parse_url(StringView url)
+{
+    auto result = URL::Parser::basic_parse(url);
+    VERIFY(result.has_value());
+    return result.release_value();
+}
+
+static void set_cookie(WebView::CookieJar& cookie_jar, StringView url, StringView cookie_string)
+{
+    auto parsed_url = parse_url(url);
+
+    auto parsed_cookie = Web::Cookie::parse_cookie(parsed_url, cookie_string);
+    VERIFY(parsed_cookie.has_value());
+
+    cookie_jar.set_cookie(parsed_url, *parsed_cookie, Web::Cookie::Source::Http);
+}
+
+static String get_cookie(WebView::CookieJar& cookie_jar, StringView url)
+{
+    return cookie_jar.get_cookie(parse_url(url), Web::Cookie::Source::Http);
+}
+
+TEST_CASE(domain_cookies_are_visible_to_subdomains)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+    set_cookie(*cookie_jar, "https://example.com/"sv, "a=1; Domain=example.com"sv);
+
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.com/"sv), "a=1"sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://www.example.com/"sv), "a=1"sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://a.b.example.com/"sv), "a=1"sv);
+
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://otherexample.com/"sv), ""sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.com.evil.org/"sv), ""sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.org/"sv), ""sv);
+}
+
+TEST_CASE(cookies_of_a_subdomain_are_not_visible_to_the_parent_domain)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+    set_cookie(*cookie_jar, "https://www.example.com/"sv, "a=1; Domain=www.example.com"sv);
+
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://www.example.com/"sv), "a=1"sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://sub.www.example.com/"sv), "a=1"sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.com/"sv), ""sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://mail.example.com/"sv), ""sv);
+}
+
+TEST_CASE(host_only_cookies_are_not_visible_to_subdomains)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+    set_cookie(*cookie_jar, "https://example.com/"sv, "a=1"sv);
+
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.com/"sv), "a=1"sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://www.example.com/"sv), ""sv);
+}
+
+TEST_CASE(cookies_of_parent_domains_are_combined)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+    set_cookie(*cookie_jar, "https://example.com/"sv, "a=1; Domain=example.com"sv);
+    set_cookie(*cookie_jar, "https://www.example.com/"sv, "b=2"sv);
+    set_cookie(*cookie_jar, "https://example.org/"sv, "c=3; Domain=example.org"sv);
+
+    auto cookies = get_cookie(*cookie_jar, "https://www.example.com/"sv);
+    EXPECT(cookies == "a=1; b=2"sv || cookies == "b=2; a=1"sv);
+
+    EXPECT_EQ(cookie_jar->get_all_cookies().size(), 3u);
+}
+
+TEST_CASE(expired_cookies_are_purged)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+    set_cookie(*cookie_jar, "https://example.com/"sv, "a=1; Max-Age=10"sv);
+    set_cookie(*cookie_jar, "https://example.com/"sv, "b=2; Max-Age=1000"sv);
+    set_cookie(*cookie_jar, "https://www.example.com/"sv, "c=3; Max-Age=10"sv);
+    EXPECT_EQ(cookie_jar->get_all_cookies().size(), 3u);
+
+    cookie_jar->expire_cookies_with_time_offset(AK::Duration::from_seconds(20));
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.com/"sv), "b=2"sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://www.example.com/"sv), ""sv);
+    EXPECT_EQ(cookie_jar->get_all_cookies().size(), 1u);
+}
+
+TEST_CASE(cookie_with_a_later_expiry_time_is_not_purged)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+
+    // The queue still holds an entry for the earlier expiry time, which must be skipped.
+    set_cookie(*cookie_jar, "https://example.com/"sv, "a=1; Max-Age=10"sv);
+    set_cookie(*cookie_jar, "https://example.com/"sv, "a=2; Max-Age=1000"sv);
+
+    cookie_jar->expire_cookies_with_time_offset(AK::Duration::from_seconds(20));
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.com/"sv), "a=2"sv);
+}
+
+TEST_CASE(cookie_with_an_earlier_expiry_time_is_purged)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+    set_cookie(*cookie_jar, "https://example.com/"sv, "a=1; Max-Age=1000"sv);
+    set_cookie(*cookie_jar, "https://example.com/"sv, "a=2; Max-Age=10"sv);
+
+    cookie_jar->expire_cookies_with_time_offset(AK::Duration::from_seconds(20));
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.com/"sv), ""sv);
+    EXPECT(cookie_jar->get_all_cookies().is_empty());
+}
+
+TEST_CASE(frequently_updated_cookies)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+
+    // Each update leaves a stale entry in the expiry queue, which is eventually rebuilt.
+    for (size_t i = 0; i < 5000; ++i) {
+        auto cookie_string = MUST(String::formatted("a={}; Max-Age={}", i, 100 + i));
+        set_cookie(*cookie_jar, "https://example.com/"sv, cookie_string);
+    }
+    set_cookie(*cookie_jar, "https://example.com/"sv, "b=1; Max-Age=10"sv);
+
+    EXPECT_EQ(cookie_jar->get_all_cookies().size(), 2u);
+
+    cookie_jar->expire_cookies_with_time_offset(AK::Duration::from_seconds(20));
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.com/"sv), "a=4999"sv);
+}
+
+TEST_CASE(clearing_all_cookies)
+{
+    auto cookie_jar = WebView::CookieJar::create();
+    set_cookie(*cookie_jar, "https://example.com/"sv, "a=1; Domain=example.com"sv);
+    set_cookie(*cookie_jar, "https://www.example.com/"sv, "b=2; Max-Age=10"sv);
+
+    cookie_jar->clear_all_cookies();
+    EXPECT(cookie_jar->get_all_cookies().is_empty());
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://www.example.com/"sv), ""sv);
+
+    set_cookie(*cookie_jar, "https://example.com/"sv, "c=3"sv);
+    EXPECT_EQ(get_cookie(*cookie_jar, "https://example.com/"sv), "c=3"sv);
+}
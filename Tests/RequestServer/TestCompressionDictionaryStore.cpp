@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibURL/Parser.h>
+#include <RequestServer/CompressionDictionaryStore.h>
+
+using RequestServer::CompressionDictionaryStore;
+
+static URL::URL parse_url(StringView url)
+{
+    auto result = URL::Parser::basic_parse(url);
+    VERIFY(result.has_value());
+    return result.release_value();
+}
+
+static HTTP::HeaderMap dictionary_headers(StringView use_as_dictionary, StringView cache_control = "max-age=3600"sv)
+{
+    HTTP::HeaderMap headers;
+    headers.set("Use-As-Dictionary", use_as_dictionary);
+    if (!cache_control.is_empty())
+        headers.set("Cache-Control", cache_control);
+    return headers;
+}
+
+static auto const first_partition = "https://first.example"_string;
+static auto const second_partition = "https://second.example"_string;
+
+TEST_CASE(parse_use_as_dictionary)
+{
+    auto result = CompressionDictionaryStore::parse_use_as_dictionary(R"~(match="/app/*.js", match-dest=("script" "worker"), id="v1")~"sv);
+    EXPECT(result.has_value());
+    EXPECT_EQ(result->match, "/app/*.js"sv);
+    EXPECT_EQ(result->match_destinations, (Vector<String> { "script"_string, "worker"_string }));
+    EXPECT_EQ(result->id, "v1"sv);
+
+    // Unknown members and parameters are ignored, and strings may contain escaped characters.
+    result = CompressionDictionaryStore::parse_use_as_dictionary(R"~(match="/a\"b";p=1, type=raw, unknown=token)~"sv);
+    EXPECT(result.has_value());
+    EXPECT_EQ(result->match, "/a\"b"sv);
+    EXPECT(result->match_destinations.is_empty());
+    EXPECT(result->id.is_empty());
+}
+
+TEST_CASE(parse_invalid_use_as_dictionary)
+{
+    // The match member is required, and has to be a string.
+    EXPECT(!CompressionDictionaryStore::parse_use_as_dictionary(R"~(id="v1")~"sv).has_value());
+    EXPECT(!CompressionDictionaryStore::parse_use_as_dictionary(R"~(match=("/app/*.js"))~"sv).has_value());
+
+    // Only raw dictionaries are supported.
+    EXPECT(!CompressionDictionaryStore::parse_use_as_dictionary(R"~(match="/app/*.js", type=brotli)~"sv).has_value());
+
+    // match-dest has to be an inner list.
+    EXPECT(!CompressionDictionaryStore::parse_use_as_dictionary(R"~(match="/app/*.js", match-dest="script")~"sv).has_value());
+
+    auto long_id = MUST(String::repeated('a', 1025));
+    EXPECT(!CompressionDictionaryStore::parse_use_as_dictionary(MUST(String::formatted(R"~(match="/", id="{}")~", long_id))).has_value());
+
+    EXPECT(!CompressionDictionaryStore::parse_use_as_dictionary(R"~(match=)~"sv).has_value());
+    EXPECT(!CompressionDictionaryStore::parse_use_as_dictionary(R"~(match="/app/*.js)~"sv).has_value());
+    EXPECT(!CompressionDictionaryStore::parse_use_as_dictionary(R"~(match="/app/*.js" id="v1")~"sv).has_value());
+}
+
+TEST_CASE(dictionaries_are_used_for_matching_requests)
+{
+    CompressionDictionaryStore store;
+    store.store_dictionary_if_needed(first_partition, parse_url("https://cdn.example/app/v1.js"sv), dictionary_headers(R"~(match="/app/*.js", id="v1")~"sv), "dictionary"sv.bytes());
+    EXPECT_EQ(store.dictionary_count(), 1u);
+
+    auto dictionary = store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/app/v2.js"sv), {});
+    EXPECT(dictionary);
+    EXPECT_EQ(dictionary->id, "v1"sv);
+    EXPECT_EQ(dictionary->content.bytes(), "dictionary"sv.bytes());
+
+    EXPECT(!store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/other/v2.js"sv), {}));
+    EXPECT(!store.find_dictionary_for_request(first_partition, parse_url("https://other.example/app/v2.js"sv), {}));
+}
+
+TEST_CASE(dictionaries_are_partitioned)
+{
+    CompressionDictionaryStore store;
+    store.store_dictionary_if_needed(first_partition, parse_url("https://cdn.example/app/v1.js"sv), dictionary_headers(R"~(match="/app/*.js")~"sv), "first"sv.bytes());
+
+    EXPECT(store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/app/v2.js"sv), {}));
+    EXPECT(!store.find_dictionary_for_request(second_partition, parse_url("https://cdn.example/app/v2.js"sv), {}));
+
+    // The same response fetched from another partition doesn't replace the first one.
+    store.store_dictionary_if_needed(second_partition, parse_url("https://cdn.example/app/v1.js"sv), dictionary_headers(R"~(match="/app/*.js")~"sv), "second"sv.bytes());
+    EXPECT_EQ(store.dictionary_count(), 2u);
+    EXPECT_EQ(store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/app/v2.js"sv), {})->content.bytes(), "first"sv.bytes());
+    EXPECT_EQ(store.find_dictionary_for_request(second_partition, parse_url("https://cdn.example/app/v2.js"sv), {})->content.bytes(), "second"sv.bytes());
+
+    store.clear();
+    EXPECT_EQ(store.dictionary_count(), 0u);
+    EXPECT(!store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/app/v2.js"sv), {}));
+}
+
+TEST_CASE(dictionaries_with_match_destinations)
+{
+    CompressionDictionaryStore store;
+    store.store_dictionary_if_needed(first_partition, parse_url("https://cdn.example/app/v1.js"sv), dictionary_headers(R"~(match="/app/*", match-dest=("script"))~"sv), "dictionary"sv.bytes());
+
+    EXPECT(store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/app/v2.js"sv), "script"sv));
+    EXPECT(!store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/app/v2.js"sv), "style"sv));
+    EXPECT(!store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/app/v2.js"sv), {}));
+}
+
+TEST_CASE(longest_match_wins)
+{
+    CompressionDictionaryStore store;
+    store.store_dictionary_if_needed(first_partition, parse_url("https://cdn.example/app/specific.js"sv), dictionary_headers(R"~(match="/app/main.*.js")~"sv), "specific"sv.bytes());
+    store.store_dictionary_if_needed(first_partition, parse_url("https://cdn.example/app/generic.js"sv), dictionary_headers(R"~(match="/app/*")~"sv), "generic"sv.bytes());
+
+    EXPECT_EQ(store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/app/main.v2.js"sv), {})->content.bytes(), "specific"sv.bytes());
+    EXPECT_EQ(store.find_dictionary_for_request(first_partition, parse_url("https://cdn.example/app/style.css"sv), {})->content.bytes(), "generic"sv.bytes());
+}
+
+TEST_CASE(responses_that_may_not_be_used_as_dictionaries)
+{
+    CompressionDictionaryStore store;
+
+    // Dictionaries have to be fresh.
+    store.store_dictionary_if_needed(first_partition, parse_url("https://cdn.example/app/v1.js"sv), dictionary_headers(R"~(match="/app/*.js")~"sv, ""sv), "dictionary"sv.bytes());
+    store.store_dictionary_if_needed(first_partition, parse_url("https://cdn.example/app/v1.js"sv), dictionary_headers(R"~(match="/app/*.js")~"sv, "max-age=3600, no-store"sv), "dictionary"sv.bytes());
+
+    // Dictionaries may only be used in secure contexts.
+    store.store_dictionary_if_needed(first_partition, parse_url("http://cdn.example/app/v1.js"sv), dictionary_headers(R"~(match="/app/*.js")~"sv), "dictionary"sv.bytes());
+
+    // URL patterns with regular expressions are not allowed.
+    store.store_dictionary_if_needed(first_partition, parse_url("https://cdn.example/app/v1.js"sv), dictionary_headers(R"~(match="/app/(\\d+).js")~"sv), "dictionary"sv.bytes());
+
+    store.store_dictionary_if_needed(first_partition, parse_url("https://cdn.example/app/v1.js"sv), dictionary_headers(R"~(match="/app/*.js")~"sv), {});
+
+    EXPECT_EQ(store.dictionary_count(), 0u);
+
+    // Except for localhost, where plain HTTP is fine.
+    store.store_dictionary_if_needed(first_partition, parse_url("http://localhost:8000/app/v1.js"sv), dictionary_headers(R"~(match="/app/*.js")~"sv), "dictionary"sv.bytes());
+    EXPECT_EQ(store.dictionary_count(), 1u);
+}
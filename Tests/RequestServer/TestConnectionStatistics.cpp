@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibTest/TestCase.h>
+#include <RequestServer/ConnectionStatistics.h>
+
+static JsonObject serialize(RequestServer::ConnectionStatistics const& statistics)
+{
+    auto json = MUST(JsonValue::from_string(statistics.serialize_as_json()));
+    VERIFY(json.is_object());
+    return json.as_object();
+}
+
+static JsonObject const& origin_statistics(JsonObject const& statistics, StringView origin)
+{
+    auto origins = statistics.get_object("origins"sv);
+    VERIFY(origins.has_value());
+
+    auto object = origins->get_object(origin);
+    VERIFY(object.has_value());
+    return *object;
+}
+
+TEST_CASE(statistics_are_disabled_by_default)
+{
+    EXPECT(!RequestServer::ConnectionStatistics::is_enabled());
+}
+
+TEST_CASE(requests_are_aggregated_per_origin)
+{
+    RequestServer::ConnectionStatistics statistics;
+
+    statistics.record_completed_request("https://example.com"_string,
+        {
+            .queue_time = AK::Duration::from_microseconds(100),
+            .tls_handshake_time = AK::Duration::from_microseconds(3000),
+            .alpn_protocol = "h2"_fly_string,
+            .bytes_sent = 10,
+            .bytes_received = 1000,
+        });
+    statistics.record_completed_request("https://example.com"_string,
+        {
+            .reused_connection = true,
+            .queue_time = AK::Duration::from_microseconds(300),
+            .alpn_protocol = "h2"_fly_string,
+            .bytes_sent = 20,
+            .bytes_received = 2000,
+            .concurrent_requests_on_connection = 3,
+        });
+    statistics.record_completed_request("https://example.org"_string, { .alpn_protocol = "http/1.1"_fly_string });
+
+    auto json = serialize(statistics);
+    EXPECT_EQ(statistics.origin_count(), 2u);
+
+    auto const& example_com = origin_statistics(json, "https://example.com"sv);
+    EXPECT_EQ(example_com.get_u64("request_count"sv), 2u);
+    EXPECT_EQ(example_com.get_u64("reused_connection_count"sv), 1u);
+    EXPECT_EQ(example_com.get_u64("bytes_sent"sv), 30u);
+    EXPECT_EQ(example_com.get_u64("bytes_received"sv), 3000u);
+    EXPECT_EQ(example_com.get_object("queue_time"sv)->get_u64("total_us"sv), 400u);
+    EXPECT_EQ(example_com.get_object("queue_time"sv)->get_u64("max_us"sv), 300u);
+    EXPECT_EQ(example_com.get_object("tls_handshake_time"sv)->get_u64("count"sv), 1u);
+    EXPECT_EQ(example_com.get_object("alpn_protocols"sv)->get_u64("h2"sv), 2u);
+    EXPECT_EQ(example_com.get_u64("multiplexed_request_count"sv), 1u);
+    EXPECT_EQ(example_com.get_u64("max_concurrent_requests_on_connection"sv), 3u);
+
+    auto const& example_org = origin_statistics(json, "https://example.org"sv);
+    EXPECT_EQ(example_org.get_u64("request_count"sv), 1u);
+    EXPECT(!example_org.has("tls_handshake_time"sv));
+    EXPECT_EQ(example_org.get_object("alpn_protocols"sv)->get_u64("http/1.1"sv), 1u);
+}
+
+TEST_CASE(least_requested_origins_are_evicted)
+{
+    RequestServer::ConnectionStatistics statistics;
+
+    // Give the first origin more requests than any other, so that it is never the one that makes room.
+    auto const frequent_origin = "https://frequent.example"_string;
+    statistics.record_completed_request(frequent_origin, {});
+    statistics.record_completed_request(frequent_origin, {});
+
+    for (size_t i = 0; i < RequestServer::ConnectionStatistics::maximum_origin_count + 10; ++i)
+        statistics.record_completed_request(MUST(String::formatted("https://{}.example", i)), {});
+
+    EXPECT_EQ(statistics.origin_count(), RequestServer::ConnectionStatistics::maximum_origin_count);
+
+    auto json = serialize(statistics);
+    EXPECT_EQ(json.get_u64("evicted_origin_count"sv), 11u);
+    EXPECT_EQ(origin_statistics(json, frequent_origin).get_u64("request_count"sv), 2u);
+
+    // Origins that are already tracked don't evict anything.
+    statistics.record_completed_request(frequent_origin, {});
+    EXPECT_EQ(serialize(statistics).get_u64("evicted_origin_count"sv), 11u);
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+#include <RequestServer/NetworkArchive.h>
+
+static constexpr auto archive_path = "/tmp/network-archive-test.jsonl"sv;
+
+static RequestServer::NetworkArchive::Entry make_entry(StringView url, StringView body, u32 status_code = 200)
+{
+    HTTP::HeaderMap headers;
+    headers.set("Content-Type", "text/plain");
+    headers.set("X-Empty", "");
+
+    return {
+        .method = "GET",
+        .url = MUST(String::from_utf8(url)),
+        .status_code = status_code,
+        .reason_phrase = "OK"_string,
+        .headers = move(headers),
+        .body = MUST(ByteBuffer::copy(body.bytes())),
+        .time_to_first_byte = AK::Duration::from_milliseconds(10),
+        .total_time = AK::Duration::from_milliseconds(110),
+    };
+}
+
+static void record_entries(ReadonlySpan<RequestServer::NetworkArchive::Entry> entries)
+{
+    auto archive = MUST(RequestServer::NetworkArchive::create_for_recording(archive_path));
+    EXPECT(archive->is_recording());
+
+    for (auto const& entry : entries)
+        MUST(archive->record(entry));
+}
+
+TEST_CASE(recorded_responses_are_replayed)
+{
+    auto entry = make_entry("https://example.com/"sv, "Hello, \0friends!"sv);
+    entry.reason_phrase = {};
+
+    Array entries { entry, make_entry("https://example.com/other"sv, ""sv, 404) };
+    record_entries(entries);
+
+    auto archive = MUST(RequestServer::NetworkArchive::load_for_replay(archive_path, {}));
+    EXPECT(archive->is_replaying());
+
+    auto const* replayed_entry = archive->find_entry_for_replay("GET"sv, "https://example.com/"sv);
+    VERIFY(replayed_entry);
+    EXPECT_EQ(replayed_entry->method, "GET"sv);
+    EXPECT_EQ(replayed_entry->url, "https://example.com/"sv);
+    EXPECT_EQ(replayed_entry->status_code, 200u);
+    EXPECT(!replayed_entry->reason_phrase.has_value());
+    EXPECT_EQ(replayed_entry->headers.get("Content-Type"), "text/plain"sv);
+    EXPECT_EQ(replayed_entry->headers.get("X-Empty"), ""sv);
+    EXPECT_EQ(replayed_entry->body, entry.body);
+    EXPECT_EQ(replayed_entry->time_to_first_byte, entry.time_to_first_byte);
+    EXPECT_EQ(replayed_entry->total_time, entry.total_time);
+
+    replayed_entry = archive->find_entry_for_replay("GET"sv, "https://example.com/other"sv);
+    VERIFY(replayed_entry);
+    EXPECT_EQ(replayed_entry->status_code, 404u);
+    EXPECT_EQ(replayed_entry->reason_phrase, "OK"sv);
+    EXPECT(replayed_entry->body.is_empty());
+
+    EXPECT(!archive->find_entry_for_replay("POST"sv, "https://example.com/"sv));
+    EXPECT(!archive->find_entry_for_replay("GET"sv, "https://example.com/missing"sv));
+
+    MUST(Core::System::unlink(archive_path));
+}
+
+TEST_CASE(responses_to_the_same_request_are_replayed_in_order)
+{
+    Array entries {
+        make_entry("https://example.com/"sv, "first"sv),
+        make_entry("https://example.com/"sv, "second"sv),
+    };
+    record_entries(entries);
+
+    auto archive = MUST(RequestServer::NetworkArchive::load_for_replay(archive_path, {}));
+
+    auto next_body = [&]() {
+        auto const* entry = archive->find_entry_for_replay("GET"sv, "https://example.com/"sv);
+        VERIFY(entry);
+        return StringView { entry->body };
+    };
+
+    EXPECT_EQ(next_body(), "first"sv);
+    EXPECT_EQ(next_body(), "second"sv);
+
+    // Once all responses have been served, the last one is served again.
+    EXPECT_EQ(next_body(), "second"sv);
+
+    MUST(Core::System::unlink(archive_path));
+}
+
+TEST_CASE(malformed_archives_are_rejected)
+{
+    {
+        auto file = MUST(Core::File::open(archive_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        MUST(file->write_until_depleted(R"({"method":"GET","url":"https://example.com/"})"sv));
+    }
+    EXPECT(RequestServer::NetworkArchive::load_for_replay(archive_path, {}).is_error());
+
+    {
+        auto file = MUST(Core::File::open(archive_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        MUST(file->write_until_depleted("[1, 2, 3]\n"sv));
+    }
+    EXPECT(RequestServer::NetworkArchive::load_for_replay(archive_path, {}).is_error());
+
+    MUST(Core::System::unlink(archive_path));
+}
+
+TEST_CASE(bodies_are_replayed_over_their_recorded_transfer_time)
+{
+    Array entries { make_entry("https://example.com/"sv, "x"sv) };
+    record_entries(entries);
+
+    auto entry = make_entry("https://example.com/"sv, ""sv);
+    entry.body = MUST(ByteBuffer::create_zeroed(1000));
+
+    {
+        auto archive = MUST(RequestServer::NetworkArchive::load_for_replay(archive_path, {}));
+
+        // 1000 bytes over the 100ms between the first and the last byte.
+        EXPECT_EQ(archive->bandwidth_for_replay(entry), 10'000u);
+
+        // A body that was received at once is also delivered at once.
+        entry.total_time = entry.time_to_first_byte;
+        EXPECT(!archive->bandwidth_for_replay(entry).has_value());
+
+        entry.body.clear();
+        entry.total_time = AK::Duration::from_seconds(1);
+        EXPECT(!archive->bandwidth_for_replay(entry).has_value());
+    }
+
+    {
+        auto archive = MUST(RequestServer::NetworkArchive::load_for_replay(archive_path, { .bandwidth_in_bytes_per_second = 123 }));
+        EXPECT_EQ(archive->bandwidth_for_replay(entry), 123u);
+    }
+
+    MUST(Core::System::unlink(archive_path));
+}
@@ -399,9 +399,17 @@
     WebView::Application::cookie_jar().dump_cookies();
 }
 
+- (void)dumpConnectionStatistics:(id)sender
+{
+    WebView::Application::the().dump_connection_statistics();
+}
+
 - (void)clearAllCookies:(id)sender
 {
     WebView::Application::cookie_jar().clear_all_cookies();
+
+    // NOTE: Compression dictionaries can identify a user just like cookies can, so they are cleared along with them.
+    WebView::Application::request_server_client().clear_compression_dictionaries();
 }
 
 - (NSMenuItem*)createApplicationMenu
@@ -663,6 +671,9 @@
     [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump Cookies"
                                                 action:@selector(dumpCookies:)
                                          keyEquivalent:@""]];
+    [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump Connection Statistics"
+                                                action:@selector(dumpConnectionStatistics:)
+                                         keyEquivalent:@""]];
     [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump Local Storage"
                                                 action:@selector(dumpLocalStorage:)
                                          keyEquivalent:@""]];
@@ -438,6 +438,12 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         WebView::Application::cookie_jar().dump_cookies();
     });
 
+    auto* dump_connection_statistics_action = new QAction("Dump Co&nnection Statistics", this);
+    debug_menu->addAction(dump_connection_statistics_action);
+    QObject::connect(dump_connection_statistics_action, &QAction::triggered, this, [] {
+        WebView::Application::the().dump_connection_statistics();
+    });
+
     auto* dump_local_storage_action = new QAction("Dump Loc&al Storage", this);
     dump_local_storage_action->setIcon(load_icon_from_uri("resource://icons/browser/local-storage.png"sv));
     debug_menu->addAction(dump_local_storage_action);
@@ -468,6 +474,26 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         debug_request("collect-garbage");
     });
 
+    auto* record_trace_action = new QAction("Record &Trace", this);
+    record_trace_action->setCheckable(true);
+    debug_menu->addAction(record_trace_action);
+    QObject::connect(record_trace_action, &QAction::triggered, this, [this, record_trace_action] {
+        debug_request(record_trace_action->isChecked() ? "start-tracing" : "stop-tracing");
+    });
+
+    auto* profile_bytecode_action = new QAction("Profile &Bytecode", this);
+    profile_bytecode_action->setCheckable(true);
+    debug_menu->addAction(profile_bytecode_action);
+    QObject::connect(profile_bytecode_action, &QAction::triggered, this, [this, profile_bytecode_action] {
+        debug_request(profile_bytecode_action->isChecked() ? "start-bytecode-profiling" : "stop-bytecode-profiling");
+    });
+
+    auto* dump_shape_memory_action = new QAction("Dump S&hape Memory", this);
+    debug_menu->addAction(dump_shape_memory_action);
+    QObject::connect(dump_shape_memory_action, &QAction::triggered, this, [this] {
+        debug_request("dump-shape-memory");
+    });
+
     auto* dump_gc_graph_action = new QAction("Dump GC graph", this);
     debug_menu->addAction(dump_gc_graph_action);
     QObject::connect(dump_gc_graph_action, &QAction::triggered, this, [this] {
@@ -490,6 +516,9 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
     debug_menu->addAction(clear_all_cookies_action);
     QObject::connect(clear_all_cookies_action, &QAction::triggered, this, [] {
         WebView::Application::cookie_jar().clear_all_cookies();
+
+        // NOTE: Compression dictionaries can identify a user just like cookies can, so they are cleared along with them.
+        WebView::Application::request_server_client().clear_compression_dictionaries();
     });
 
     auto* spoof_user_agent_menu = debug_menu->addMenu("Spoof &User Agent");
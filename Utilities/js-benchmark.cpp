@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <AK/NeverDestroyed.h>
+#include <AK/QuickSort.h>
+#include <AK/ScopeGuard.h>
+#include <AK/Vector.h>
+#include <LibCore/ArgsParser.h>
+#include <LibCore/DirIterator.h>
+#include <LibCore/ElapsedTimer.h>
+#include <LibCore/Environment.h>
+#include <LibCore/File.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/Promise.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/Script.h>
+#include <LibMain/Main.h>
+
+// Each benchmark is a script that defines a global `benchmark` function. The script itself is run once to set
+// things up, then `benchmark()` is called a number of times to warm up and a number of times while being timed.
+// If `benchmark()` returns a promise, it must settle once all queued promise jobs have run.
+
+// FIXME: https://github.com/LadybirdBrowser/ladybird/issues/2412
+//    We should be able to destroy the VM on process exit.
+static NeverDestroyed<RefPtr<JS::VM>> s_vm;
+
+struct BytecodeStatistics {
+    u64 executables { 0 };
+    u64 instructions { 0 };
+    u64 bytes { 0 };
+};
+
+struct BenchmarkResult {
+    ByteString name;
+    Vector<AK::Duration> runs;
+    GC::Heap::Statistics gc;
+    BytecodeStatistics bytecode;
+};
+
+static ByteString exception_to_string(JS::Value exception)
+{
+    if (exception.is_object()) {
+        auto& object = exception.as_object();
+        auto name = object.get_without_side_effects("name"_fly_string);
+        auto message = object.get_without_side_effects("message"_fly_string);
+        if (name.is_string() && message.is_string())
+            return ByteString::formatted("{}: {}", name.as_string().utf8_string_view(), message.as_string().utf8_string_view());
+    }
+    return exception.to_string_without_side_effects().to_byte_string();
+}
+
+static ErrorOr<void, ByteString> call_benchmark_function(JS::VM& vm, JS::FunctionObject& function)
+{
+    auto result = JS::call(vm, function, JS::js_undefined());
+    if (result.is_error())
+        return exception_to_string(result.release_error().value());
+
+    vm.run_queued_promise_jobs();
+
+    auto value = result.release_value();
+    if (!value.is_object() || !is<JS::Promise>(value.as_object()))
+        return {};
+
+    auto& promise = static_cast<JS::Promise&>(value.as_object());
+    switch (promise.state()) {
+    case JS::Promise::State::Fulfilled:
+        return {};
+    case JS::Promise::State::Rejected:
+        return exception_to_string(promise.result());
+    case JS::Promise::State::Pending:
+        return ByteString { "The promise returned by benchmark() did not settle"sv };
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static BytecodeStatistics bytecode_statistics_for_source(GC::Heap& heap, StringView filename)
+{
+    BytecodeStatistics statistics;
+    heap.for_each_live_cell([&](GC::Cell* cell) {
+        auto* executable = as_if<JS::Bytecode::Executable>(cell);
+        if (!executable || executable->source_code->filename() != filename)
+            return;
+
+        ++statistics.executables;
+        statistics.bytes += executable->bytecode.size();
+        for (JS::Bytecode::InstructionStreamIterator it(executable->bytecode); !it.at_end(); ++it)
+            ++statistics.instructions;
+    });
+    return statistics;
+}
+
+static GC::Heap::Statistics operator-(GC::Heap::Statistics const& after, GC::Heap::Statistics const& before)
+{
+    return {
+        .collections = after.collections - before.collections,
+        .allocated_cells = after.allocated_cells - before.allocated_cells,
+        .allocated_bytes = after.allocated_bytes - before.allocated_bytes,
+        .collected_cells = after.collected_cells - before.collected_cells,
+        .collected_bytes = after.collected_bytes - before.collected_bytes,
+        .time_spent_collecting = after.time_spent_collecting - before.time_spent_collecting,
+    };
+}
+
+static ErrorOr<BenchmarkResult, ByteString> run_benchmark(ByteString const& name, ByteString const& path, size_t warmup_iterations, size_t iterations)
+{
+    auto& vm = **s_vm;
+    auto& heap = vm.heap();
+
+    auto file = Core::File::open(path, Core::File::OpenMode::Read);
+    if (file.is_error())
+        return ByteString::formatted("Could not open {}: {}", path, file.error());
+    auto source = file.value()->read_until_eof();
+    if (source.is_error())
+        return ByteString::formatted("Could not read {}: {}", path, source.error());
+
+    // Start from a clean heap, so that garbage left behind by the previous benchmark isn't billed to this one.
+    heap.collect_garbage();
+    auto gc_statistics_before = heap.statistics();
+
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(vm);
+    auto& realm = *root_execution_context->realm;
+    ScopeGuard pop_execution_context = [&] { vm.pop_execution_context(); };
+
+    auto script = JS::Script::parse(StringView { source.value() }, realm, path);
+    if (script.is_error())
+        return script.error()[0].to_byte_string();
+
+    if (auto result = vm.bytecode_interpreter().run(*script.value()); result.is_error())
+        return exception_to_string(result.release_error().value());
+    vm.run_queued_promise_jobs();
+
+    auto benchmark_function = realm.global_object().get_without_side_effects("benchmark"_fly_string);
+    if (!benchmark_function.is_function())
+        return ByteString { "The script does not define a benchmark() function"sv };
+
+    for (size_t i = 0; i < warmup_iterations; ++i)
+        TRY(call_benchmark_function(vm, benchmark_function.as_function()));
+
+    BenchmarkResult result { .name = name };
+    result.runs.ensure_capacity(iterations);
+
+    for (size_t i = 0; i < iterations; ++i) {
+        auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        TRY(call_benchmark_function(vm, benchmark_function.as_function()));
+        result.runs.unchecked_append(timer.elapsed_time());
+    }
+
+    result.gc = heap.statistics() - gc_statistics_before;
+    result.bytecode = bytecode_statistics_for_source(heap, path);
+    return result;
+}
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+}
+
+static double median_in_milliseconds(Vector<AK::Duration> runs)
+{
+    VERIFY(!runs.is_empty());
+    quick_sort(runs);
+    if (runs.size() % 2 == 1)
+        return to_milliseconds(runs[runs.size() / 2]);
+    return (to_milliseconds(runs[runs.size() / 2 - 1]) + to_milliseconds(runs[runs.size() / 2])) / 2.0;
+}
+
+static JsonObject result_to_json(BenchmarkResult const& result)
+{
+    JsonArray runs;
+    AK::Duration total;
+    AK::Duration fastest = result.runs.first();
+    for (auto run : result.runs) {
+        runs.must_append(to_milliseconds(run));
+        total += run;
+        fastest = min(fastest, run);
+    }
+
+    JsonObject gc;
+    gc.set("collections"sv, result.gc.collections);
+    gc.set("allocated_cells"sv, result.gc.allocated_cells);
+    gc.set("allocated_bytes"sv, result.gc.allocated_bytes);
+    gc.set("collected_cells"sv, result.gc.collected_cells);
+    gc.set("collected_bytes"sv, result.gc.collected_bytes);
+    gc.set("time_ms"sv, to_milliseconds(result.gc.time_spent_collecting));
+
+    JsonObject bytecode;
+    bytecode.set("executables"sv, result.bytecode.executables);
+    bytecode.set("instructions"sv, result.bytecode.instructions);
+    bytecode.set("bytes"sv, result.bytecode.bytes);
+
+    JsonObject object;
+    object.set("name"sv, result.name.view());
+    object.set("runs_ms"sv, move(runs));
+    object.set("min_ms"sv, to_milliseconds(fastest));
+    object.set("mean_ms"sv, to_milliseconds(total) / static_cast<double>(result.runs.size()));
+    object.set("median_ms"sv, median_in_milliseconds(result.runs));
+    object.set("gc"sv, move(gc));
+    object.set("bytecode"sv, move(bytecode));
+    return object;
+}
+
+static void collect_benchmark_paths(ByteString const& directory, Vector<ByteString>& paths)
+{
+    Core::DirIterator iterator(directory, Core::DirIterator::Flags::SkipDots);
+    while (iterator.has_next()) {
+        auto path = LexicalPath::join(directory, iterator.next_path()).string();
+        if (FileSystem::is_directory(path))
+            collect_benchmark_paths(path, paths);
+        else if (path.ends_with(".js"sv))
+            paths.append(move(path));
+    }
+}
+
+static ErrorOr<HashMap<ByteString, double>> load_baseline(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto json = TRY(JsonValue::from_string(TRY(file->read_until_eof())));
+    if (!json.is_object())
+        return Error::from_string_literal("Baseline is not a JSON object");
+
+    HashMap<ByteString, double> medians;
+    auto benchmarks = json.as_object().get_array("benchmarks"sv);
+    if (!benchmarks.has_value())
+        return Error::from_string_literal("Baseline has no benchmarks array");
+
+    benchmarks->for_each([&](JsonValue const& benchmark) {
+        if (!benchmark.is_object())
+            return;
+        auto name = benchmark.as_object().get_string("name"sv);
+        auto median = benchmark.as_object().get_double_with_precision_loss("median_ms"sv);
+        if (name.has_value() && median.has_value())
+            medians.set(name->to_byte_string(), *median);
+    });
+    return medians;
+}
+
+ErrorOr<int> ladybird_main(Main::Arguments arguments)
+{
+    StringView baseline_path;
+    StringView output_path;
+    StringView filter;
+    size_t iterations = 10;
+    size_t warmup_iterations = 3;
+    double regression_threshold = 5.0;
+    Vector<ByteString> benchmark_roots;
+
+    Core::ArgsParser args_parser;
+    args_parser.set_general_help("Run the LibJS benchmark suite and report timings, GC statistics and bytecode sizes as JSON.");
+    args_parser.add_option(iterations, "Number of timed iterations per benchmark (default: 10)", "iterations", 'n', "count");
+    args_parser.add_option(warmup_iterations, "Number of untimed iterations per benchmark (default: 3)", "warmup", 'w', "count");
+    args_parser.add_option(filter, "Only run benchmarks whose name contains this string", "filter", 'f', "string");
+    args_parser.add_option(output_path, "Write the JSON report to this file instead of standard output", "output", 'o', "path");
+    args_parser.add_option(baseline_path, "Compare against a previous JSON report", "baseline", 'b', "path");
+    args_parser.add_option(regression_threshold, "Median slowdown in percent that counts as a regression (default: 5)", "threshold", 't', "percent");
+    args_parser.add_positional_argument(benchmark_roots, "Benchmark files or directories", "benchmarks", Core::ArgsParser::Required::No);
+    args_parser.parse(arguments);
+
+    if (iterations == 0) {
+        warnln("At least one timed iteration is required");
+        return 1;
+    }
+
+    if (benchmark_roots.is_empty()) {
+        auto ladybird_source_dir = Core::Environment::get("LADYBIRD_SOURCE_DIR"sv);
+        if (!ladybird_source_dir.has_value()) {
+            warnln("No benchmarks given, {} requires the LADYBIRD_SOURCE_DIR environment variable to be set", arguments.strings[0]);
+            return 1;
+        }
+        benchmark_roots.append(LexicalPath::join(*ladybird_source_dir, "Libraries"sv, "LibJS"sv, "Benchmarks"sv).string());
+    }
+
+    Vector<ByteString> names;
+    Vector<ByteString> paths;
+    for (auto const& root : benchmark_roots) {
+        if (!FileSystem::is_directory(root)) {
+            names.append(LexicalPath::title(root));
+            paths.append(root);
+            continue;
+        }
+
+        Vector<ByteString> paths_in_root;
+        collect_benchmark_paths(root, paths_in_root);
+        quick_sort(paths_in_root);
+        for (auto& path : paths_in_root) {
+            names.append(LexicalPath::relative_path(path, root).value_or(path));
+            paths.append(move(path));
+        }
+    }
+
+    HashMap<ByteString, double> baseline;
+    if (!baseline_path.is_empty())
+        baseline = TRY(load_baseline(baseline_path));
+
+    s_vm.get() = JS::VM::create();
+
+    JsonArray benchmarks;
+    bool had_failure = false;
+    bool had_regression = false;
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+        auto const& name = names[i];
+        if (!filter.is_empty() && !name.contains(filter))
+            continue;
+
+        warn("{}... ", name);
+        auto result = run_benchmark(name, paths[i], warmup_iterations, iterations);
+        if (result.is_error()) {
+            warnln("FAILED: {}", result.error());
+            had_failure = true;
+            continue;
+        }
+
+        auto json = result_to_json(result.value());
+        auto median = json.get_double_with_precision_loss("median_ms"sv).value();
+        warn("{:.3} ms", median);
+
+        if (auto baseline_median = baseline.get(name); baseline_median.has_value() && *baseline_median > 0) {
+            auto change = (median - *baseline_median) / *baseline_median * 100.0;
+            json.set("baseline_median_ms"sv, *baseline_median);
+            json.set("change_percent"sv, change);
+            warn(" ({:+.1}%)", change);
+            if (change > regression_threshold) {
+                warn(" REGRESSION");
+                had_regression = true;
+            }
+        }
+        warnln();
+
+        benchmarks.must_append(move(json));
+    }
+
+    JsonObject report;
+    report.set("iterations"sv, iterations);
+    report.set("warmup_iterations"sv, warmup_iterations);
+    report.set("benchmarks"sv, move(benchmarks));
+
+    if (output_path.is_empty()) {
+        outln("{}", report.serialized());
+    } else {
+        auto file = TRY(Core::File::open(output_path, Core::File::OpenMode::Write));
+        TRY(file->write_until_depleted(report.serialized().bytes()));
+    }
+
+    if (had_failure)
+        return 1;
+    if (had_regression)
+        return 2;
+    return 0;
+}
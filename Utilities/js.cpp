@@ -10,6 +10,7 @@
 #include <AK/JsonValue.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/Platform.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
@@ -17,6 +18,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Profiler.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
 #include <LibJS/Parser.h>
@@ -810,6 +812,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool disable_syntax_highlight = false;
     bool disable_debug_printing = false;
     bool use_test262_global = false;
+    bool profile_bytecode = false;
     StringView evaluate_script;
     Vector<StringView> script_paths;
 
@@ -827,6 +830,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
+    args_parser.add_option(profile_bytecode, "Print a bytecode execution profile after running the scripts", "profile-bytecode", {});
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -911,6 +915,12 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
+        g_vm->bytecode_interpreter().set_profiling_enabled(profile_bytecode);
+        ScopeGuard print_bytecode_profile = [&] {
+            if (auto* profiler = g_vm->bytecode_interpreter().profiler())
+                warnln("{}", profiler->report());
+        };
+
         if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
             return 1;
     }